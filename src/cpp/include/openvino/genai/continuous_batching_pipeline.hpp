@@ -229,5 +229,20 @@ public:
     * @brief finish chat and clear kv cache.
     */
     void finish_chat();
+
+    /**
+    * @brief Saves the prefix cache into a snapshot file, so that another pipeline with the same model and KV-cache
+    * configuration can be warm-started with it. Requires prefix caching to be enabled and no requests in progress.
+    * @param path Path to the snapshot file.
+    */
+    void save_prefix_cache(const std::filesystem::path& path);
+
+    /**
+    * @brief Loads the prefix cache from a snapshot file written by save_prefix_cache. Requires prefix caching to be enabled
+    * and no requests in progress.
+    * @param path Path to the snapshot file.
+    * @return false if the snapshot was made for a different model or KV-cache configuration and was not loaded.
+    */
+    bool load_prefix_cache(const std::filesystem::path& path);
 };
 }
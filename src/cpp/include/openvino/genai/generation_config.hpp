@@ -617,12 +617,23 @@ operator|(const StructuredOutputConfig::StructuralTag& lhs,
  * @param assistant_confidence_threshold the lower token probability of candidate to be validated by main model in case of dynamic strategy candidates number update.
           NOTE: `assistant_confidence_threshold` is supported only by ContinuousBatching backend for Speculative Decode.
  * @param num_assistant_tokens the defined candidates number to be generated by draft model/prompt lookup in case of static strategy candidates number update.
- *        NOTE: ContinuousBatching backend for Speculative Decode uses `num_assistant_tokens` as is. Stateful backend for Speculative Decode uses `num_assistant_tokens`'s
- *        copy as initial value and adjusts it based on recent number of accepted tokens. If `num_assistant_tokens` is not set, it defaults to `5` for both backends.
+ *        NOTE: ContinuousBatching backend for Speculative Decode uses `num_assistant_tokens` as initial value and then chooses the number of candidates per request
+ *        between 1 and `2 * num_assistant_tokens` from the request's acceptance rate and the measured costs of the draft and main models at the current batch size.
+ *        Stateful backend for Speculative Decode uses `num_assistant_tokens`'s copy as initial value and adjusts it based on recent number of accepted tokens.
+ *        If `num_assistant_tokens` is not set, it defaults to `5` for both backends.
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
  *
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
  * 
+ * Scheduling parameters (supported by ContinuousBatching backend only):
+ * @param priority the priority class of the request. Requests of higher priority are scheduled first and are preempted last
+ *        when the KV cache is exhausted. (default: 0).
+ * @param ttft_deadline_ms the desired time to first token in milliseconds. Among waiting requests of the same priority,
+ *        requests closer to their deadlines are admitted first. Admitted requests keep their order. 0 means no deadline. (default: 0).
+ * @param tpot_deadline_ms the desired time per output token in milliseconds, used in the same way as `ttft_deadline_ms`
+ *        for requests which wait to be resumed after a preemption once the first token has been generated.
+ *        0 means no deadline. (default: 0).
+ *
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
  */
 class OPENVINO_GENAI_EXPORTS GenerationConfig {
@@ -680,6 +691,11 @@ public:
 
     std::optional<AdapterConfig> adapters;
 
+    // Scheduling parameters
+    size_t priority = 0;
+    size_t ttft_deadline_ms = 0;
+    size_t tpot_deadline_ms = 0;
+
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
@@ -758,5 +774,9 @@ static constexpr ov::Property<std::string> backend{"backend"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
+static constexpr ov::Property<size_t> priority{"priority"};
+static constexpr ov::Property<size_t> ttft_deadline_ms{"ttft_deadline_ms"};
+static constexpr ov::Property<size_t> tpot_deadline_ms{"tpot_deadline_ms"};
+
 }  // namespace genai
 }  // namespace ov
@@ -111,8 +111,11 @@ public:
 
     void cancel();
 
-    // Reads result of a generation for single iteration
+    // Waits for new results, then drains all the outputs pushed since the previous read and merges them per sequence
     GenerationOutputs read();
+    // Reads results generated since the previous read without waiting, reusing the storage of the outputs.
+    // Generated ids and log probs of the outputs are replaced by the new ones, returns false if there were no new results
+    bool read_available(GenerationOutputs& outputs);
     // Reads all generated tokens for all sequences
     std::vector<GenerationOutput> read_all();
 };
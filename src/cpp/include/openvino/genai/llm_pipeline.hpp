@@ -396,6 +396,24 @@ static constexpr ov::Property<SchedulerConfig> scheduler_config{"scheduler_confi
 */
 static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 
+/**
+* @brief self_speculative_draft_layers property serves to activate self-speculative decoding.
+* Set the number of the first decoder layers of the main model to build the draft model from: the draft model exits
+* early after these layers and reuses the embeddings and the LM head of the main model, so no separate draft model is needed.
+* The draft model keeps its own KV cache for these layers, which is allocated in addition to the KV cache of the main model.
+* And create LLMPipeline instance with this config.
+*/
+static constexpr ov::Property<size_t> self_speculative_draft_layers{"self_speculative_draft_layers"};
+
+/**
+* @brief chat_sessions_cache_size property serves to keep the KV cache of several chat sessions in the stateful pipeline.
+* Set the host memory budget in bytes for the KV cache of suspended chat sessions: when generate() is called with a ChatHistory
+* which does not continue the current session, the current session is saved and the session it continues is restored,
+* so that only the new messages are encoded. The least recently suspended sessions are dropped to fit the budget.
+* Applicable to the stateful pipeline only, the continuous batching pipeline reuses KV cache of sessions with prefix caching.
+*/
+static constexpr ov::Property<size_t> chat_sessions_cache_size{"chat_sessions_cache_size"};
+
 /**
 * @brief enable enable_save_ov_model property serves to serialize ov model (xml/bin) generated from gguf model on disk for re-use.
 * Set `true` to activate this mode.
@@ -6,6 +6,7 @@
 #include <limits>
 #include <variant>
 #include <string>
+#include <vector>
 #include <optional>
 #include <filesystem>
 
@@ -54,7 +55,8 @@ struct OPENVINO_GENAI_EXPORTS AdapterConfig {
         MODE_DYNAMIC,       // A, B, alpha are fully variable
         MODE_STATIC_RANK,   // A and B have static shape, alpha is variable // FIXME: WA to unlock experiments, gives a unique perf level
         MODE_STATIC,        // A, B and alpha are constants. Use instead of MODE_FUSE if preserving weights precision is required at the cost of inference time
-        MODE_FUSE           // A, B and alpha are constants, fused to main matrix W
+        MODE_FUSE,          // A, B and alpha are constants, fused to main matrix W
+        MODE_PER_REQUEST    // A, B and alpha are variables stacking the resident adapters, each request in a continuous batch uses its own adapters
     };
 
     Mode get_mode() const { return mode; }
@@ -70,6 +72,13 @@ struct OPENVINO_GENAI_EXPORTS AdapterConfig {
     const std::optional<std::string>& get_tensor_name_prefix() const { return tensor_name_prefix; }
     void set_tensor_name_prefix(const std::optional<std::string>& _tensor_name_prefix) { tensor_name_prefix = _tensor_name_prefix; }
 
+    // Methods to get and set the number of adapters kept resident in the model in MODE_PER_REQUEST.
+    // The adapters of the config passed to a pipeline are the ones the requests can use, and the least recently used
+    // of them are evicted from the model when it is exceeded. The adapters of the requests of one step are kept resident
+    // even if there are more of them. The cost of a step grows with the total rank of the resident adapters.
+    size_t get_max_resident_adapters() const { return max_resident_adapters; }
+    void set_max_resident_adapters(size_t _max_resident_adapters) { max_resident_adapters = _max_resident_adapters; }
+
     AdapterConfig (Mode mode = MODE_AUTO);
 
     AdapterConfig (const Adapter& adapter, float alpha, Mode mode = MODE_AUTO) : AdapterConfig(std::vector<std::pair<Adapter, float>>{{adapter, alpha}}, mode) {}
@@ -109,6 +118,7 @@ private:
     std::vector<Adapter> adapters;
     std::vector<float> alphas;
     std::optional<std::string> tensor_name_prefix;
+    size_t max_resident_adapters = 16;
 
 };
 
@@ -200,6 +210,16 @@ public:
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
 
+    // Makes the adapters of each request in a batch resident in a model transformed in AdapterConfig::MODE_PER_REQUEST.
+    // Returns the index to be set for each token of the corresponding request in the "lora_adapter_indices" input,
+    // std::nullopt in `configs` means the adapters configured in the current config.
+    std::vector<int32_t> apply_per_request(ov::InferRequest request, const std::vector<std::optional<AdapterConfig>>& configs);
+
+    // Returns an identifier of the adapters and alphas used by a request in AdapterConfig::MODE_PER_REQUEST, 0 if it uses no adapters.
+    // Requests with the same identifier compute the same KV cache for the same tokens, so it can be mixed into prefix cache hashes.
+    // Throws if the request uses an adapter which the model was not transformed with.
+    size_t get_per_request_id(const std::optional<AdapterConfig>& config) const;
+
     operator bool() const {
         return bool(m_pimpl);
     }
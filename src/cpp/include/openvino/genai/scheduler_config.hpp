@@ -5,11 +5,22 @@
 
 #include <cstddef>
 #include <sstream>
+#include <string>
 
 #include "openvino/genai/cache_eviction.hpp"
 #include "openvino/genai/sparse_attention.hpp"
 
 namespace ov::genai {
+
+/**
+ * @brief Represents the order in which requests waiting for their prompt to be processed are admitted by the scheduler.
+ */
+enum class AdmissionPolicy {
+    FCFS,        // requests are admitted in the order they were added to the pipeline
+    CACHE_AWARE  // requests with longer prefix cache hits are admitted first, requests sharing an uncached prefix
+                 // wait until the prefix is computed by one of them; requires `enable_prefix_caching`
+};
+
 struct SchedulerConfig {
     // a maximum number of tokens to batch
     // (in contrast to max_batch_size which combines independent sequences, we consider total amount of tokens in a batch)
@@ -48,6 +59,13 @@ struct SchedulerConfig {
     // vLLM-like settings
     //
 
+    // Size of the host memory pool in GB used to preempt sequences by swapping.
+    // When non-zero and the KV-cache is exhausted, the KV-blocks of a preempted sequence are copied to the pool and
+    // copied back when the sequence is resumed, instead of being recomputed. Swapping is chosen per sequence when
+    // copying its blocks is estimated to be cheaper than recomputing them, based on measured inference and copy times.
+    // When zero, preempted sequences are always recomputed.
+    std::size_t swap_space = 0;
+
     // max number of scheduled sequences. 
     // You can think of it as "max batch size" on generate phase, on prompt phase number of scheduled tokens usually more than number of sequences.
     std::size_t max_num_seqs = 256;
@@ -61,6 +79,31 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
+    // Size of the host RAM tier of the prefix cache in GB. Has effect only if `enable_prefix_caching` is turned on.
+    // When non-zero, the contents of prefix-cached KV-blocks which have to be overwritten in the KV-cache are copied to
+    // host memory and copied back instead of being recomputed when a new prompt has the same prefix.
+    // When the host tier is full, least recently used blocks are spilled to `prefix_cache_offload_dir` or dropped.
+    std::size_t prefix_cache_offload_size = 0;
+
+    // Directory to spill KV-blocks evicted from the host RAM tier of the prefix cache to.
+    // Spilling is disabled if the directory is not set or `prefix_cache_offload_dir_size` is zero.
+    std::string prefix_cache_offload_dir;
+
+    // Maximum total size of KV-blocks spilled to `prefix_cache_offload_dir` in GB.
+    std::size_t prefix_cache_offload_dir_size = 0;
+
+    // Path to a prefix cache snapshot written by ContinuousBatchingPipeline::save_prefix_cache.
+    // Has effect only if `enable_prefix_caching` is turned on. If the file exists, the pipeline is warm-started with
+    // the cached KV-blocks, provided that the snapshot was made for the same model and KV-cache layout.
+    std::string prefix_cache_snapshot_path;
+
+    // Order in which waiting requests are admitted. Has effect only if `enable_prefix_caching` is turned on.
+    AdmissionPolicy admission_policy = AdmissionPolicy::FCFS;
+
+    // Number of scheduling steps after which a waiting request is admitted in arrival order regardless of
+    // `admission_policy`, so that requests without prefix cache hits are not starved.
+    std::size_t admission_max_wait_steps = 32;
+
     /** Whether to apply block-wise sparse attention to the prefill stage.
      */
     bool use_sparse_attention = false;
@@ -72,7 +115,14 @@ struct SchedulerConfig {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               swap_space == other.swap_space &&
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               prefix_cache_offload_size == other.prefix_cache_offload_size &&
+               prefix_cache_offload_dir == other.prefix_cache_offload_dir &&
+               prefix_cache_offload_dir_size == other.prefix_cache_offload_dir_size &&
+               prefix_cache_snapshot_path == other.prefix_cache_snapshot_path &&
+               admission_policy == other.admission_policy &&
+               admission_max_wait_steps == other.admission_max_wait_steps;
     }
 
     /**
@@ -93,8 +143,23 @@ struct SchedulerConfig {
         if (use_cache_eviction) {
             oss << cache_eviction_config.to_string() << "\n";
         }
+        if (swap_space > 0) {
+            oss << "  swap_space: " << swap_space << "\n";
+        }
         oss << "  max_num_seqs: " << max_num_seqs << "\n";
         oss << "  enable_prefix_caching: " << std::boolalpha << enable_prefix_caching << "\n";
+        if (enable_prefix_caching && prefix_cache_offload_size + prefix_cache_offload_dir_size > 0) {
+            oss << "  prefix_cache_offload_size: " << prefix_cache_offload_size << "\n";
+            oss << "  prefix_cache_offload_dir: " << prefix_cache_offload_dir << "\n";
+            oss << "  prefix_cache_offload_dir_size: " << prefix_cache_offload_dir_size << "\n";
+        }
+        if (enable_prefix_caching && !prefix_cache_snapshot_path.empty()) {
+            oss << "  prefix_cache_snapshot_path: " << prefix_cache_snapshot_path << "\n";
+        }
+        if (enable_prefix_caching && admission_policy == AdmissionPolicy::CACHE_AWARE) {
+            oss << "  admission_policy: CACHE_AWARE\n";
+            oss << "  admission_max_wait_steps: " << admission_max_wait_steps << "\n";
+        }
         oss << "  use_sparse_attention: " << std::boolalpha << use_sparse_attention << "\n";
         if (use_sparse_attention) {
             oss << sparse_attention_config.to_string() << "\n";
@@ -27,6 +27,9 @@ struct TokenizedInputs {
     ov::Tensor input_ids;
     ov::Tensor attention_mask;
     std::optional<ov::Tensor> token_type_ids;
+    // set for results encoded with return_ragged: input_ids and attention_mask are 1D tensors of the tokens of all
+    // prompts without padding, and the tokens of the i-th prompt are in [offsets[i], offsets[i + 1])
+    std::optional<ov::Tensor> offsets;
 };
 
 /**
@@ -131,7 +134,8 @@ public:
     /**
     * @brief encode batch of prompts.
     * @param prompts vector storing batch of prompts
-    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}},
+    * also bucket_size and return_ragged
     * @return pair of [input_ids, attention_mask]
     */
     TokenizedInputs encode(const std::vector<std::string>& prompt, const ov::AnyMap& tokenization_params = {});
@@ -180,6 +184,8 @@ public:
     * @param max_length optional maximum length to which output will be truncated and/or padded. If not defined, taken from IR (where default value from original HF/GGUF model is stored).
     * @param pad_to_max_length either pad to max_length, or pad to the longest sequence in the batch. Default is false.
     * @param padding_side side to pad, either "left" or "right". If not defined value is taken from IR (where default value from original HF/GGUF model is stored).
+    * @param bucket_size optional number of prompts in a bucket. Larger batches are sorted by prompt length and split into buckets, which are tokenized concurrently.
+    * @param return_ragged whether to return the tokens without padding, concatenated with the offsets of each prompt. Default is false.
     * @return pair of [input_ids, attention_mask]
     */
     template <typename... Properties>
@@ -326,6 +332,7 @@ public:
 private:
     friend class StructuredOutputConfig;
     friend class Sampler;
+    friend class TokenizerInternalAccessor;
     std::shared_ptr<TokenizerImpl> m_pimpl;
 };
 
@@ -334,6 +341,16 @@ static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
 static constexpr ov::Property<bool> skip_special_tokens{"skip_special_tokens"};
 static constexpr ov::Property<bool> pad_to_max_length{"pad_to_max_length"};
 static constexpr ov::Property<std::string> padding_side{"padding_side"};
+/**
+ * @brief Number of prompts in a bucket of a batch. Prompts of larger batches are sorted by length and split into buckets,
+ * which are tokenized concurrently on several infer requests and padded only to the longest prompt of the bucket before
+ * the results are put back in the order of the prompts.
+ */
+static constexpr ov::Property<size_t> bucket_size{"bucket_size"};
+/**
+ * @brief Whether to return the tokens of a batch without padding, see TokenizedInputs::offsets.
+ */
+static constexpr ov::Property<bool> return_ragged{"return_ragged"};
 
 }  // namespace genai
 }  // namespace ov
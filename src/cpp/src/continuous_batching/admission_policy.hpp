@@ -0,0 +1,186 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/scheduler_config.hpp"
+#include "continuous_batching/block_manager.hpp"
+#include "sequence_group.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Decides in which order the Scheduler admits sequence groups waiting for their prompt phase.
+ * The policy is consulted at the beginning of each scheduling step and may reorder the sequence groups;
+ * the resulting order is then used consistently by the Scheduler, the ModelRunner and the Sampler within the step.
+ */
+class IAdmissionPolicy {
+public:
+    virtual ~IAdmissionPolicy() = default;
+
+    /**
+     * Called at the beginning of each scheduling step.
+     * @param sequence_groups All sequence groups known to the pipeline, may be reordered in-place.
+     */
+    virtual void order(std::vector<SequenceGroup::Ptr>& sequence_groups) = 0;
+
+    /**
+     * @param sequence_group A sequence group in its prompt phase.
+     * @return Whether the prompt of the sequence group must not be scheduled at the current step.
+     */
+    virtual bool is_deferred(const SequenceGroup::Ptr& sequence_group) {
+        return false;
+    }
+
+    /**
+     * Called after prompt tokens of a sequence group have been scheduled at the current step.
+     * @param sequence_group The sequence group.
+     */
+    virtual void on_prompt_scheduled(const SequenceGroup::Ptr& sequence_group) {}
+};
+
+/**
+ * @brief Admits sequence groups in the order in which they have been added to the pipeline.
+ */
+class FCFSAdmissionPolicy : public IAdmissionPolicy {
+public:
+    void order(std::vector<SequenceGroup::Ptr>& sequence_groups) override {}
+};
+
+/**
+ * @brief Admits sequence groups so that the prefix cache is reused as much as possible:
+ * - groups which have restored a longer part of their prompt from the prefix cache are admitted first, since they
+ *   require less computation and already hold their restored KV-cache blocks;
+ * - a group without a prefix cache hit, whose first block is being computed by another group in its prompt phase,
+ *   is deferred until that prompt phase is completed, after which the group restores the computed blocks
+ *   instead of recomputing them.
+ * A group that has waited for `max_wait_steps` scheduling steps is admitted in arrival order ahead of all other waiting
+ * groups, so that no group starves. Groups which have already been admitted keep their relative order.
+ */
+class CacheAwareAdmissionPolicy : public IAdmissionPolicy {
+    struct RequestInfo {
+        size_t arrival_step;
+        size_t arrival_idx;
+        // hash of the first full block of the prompt
+        std::optional<size_t> prefix_key;
+        bool admitted = false;
+        bool deferred = false;
+    };
+
+    std::shared_ptr<BlockManager> m_block_manager;
+    size_t m_block_size;
+    size_t m_max_wait_steps;
+    size_t m_step = 0;
+    size_t m_num_arrived = 0;
+    // keyed by request id
+    std::unordered_map<uint64_t, RequestInfo> m_requests;
+    // prefix key -> id of the admitted request whose prompt phase computes the blocks for this key
+    std::unordered_map<size_t, uint64_t> m_prefix_owners;
+
+    static bool _is_in_prompt_phase(const SequenceGroup::Ptr& sequence_group) {
+        return !sequence_group->can_generate_tokens() && !sequence_group->has_finished();
+    }
+
+    bool _is_aged(const RequestInfo& info) const {
+        return m_step - info.arrival_step >= m_max_wait_steps;
+    }
+
+    std::optional<size_t> _get_prefix_key(const SequenceGroup::Ptr& sequence_group) const {
+        if (sequence_group->get_prompt_len() < m_block_size || sequence_group->num_total_seqs() != 1) {
+            return std::nullopt;
+        }
+        return (*sequence_group)[0]->get_hash(m_block_size);
+    }
+
+public:
+    /**
+     * Constructs the CacheAwareAdmissionPolicy.
+     * @param block_manager The block manager of the scheduler, must have prefix caching enabled.
+     * @param max_wait_steps Number of scheduling steps after which a waiting group is admitted in arrival order.
+     */
+    CacheAwareAdmissionPolicy(std::shared_ptr<BlockManager> block_manager, size_t max_wait_steps) :
+        m_block_manager(std::move(block_manager)),
+        m_block_size(m_block_manager->get_block_size()),
+        m_max_wait_steps(max_wait_steps) {}
+
+    void order(std::vector<SequenceGroup::Ptr>& sequence_groups) override {
+        ++m_step;
+
+        std::unordered_map<uint64_t, SequenceGroup::Ptr> live_requests;
+        for (const auto& sequence_group : sequence_groups) {
+            uint64_t request_id = sequence_group->get_request_id();
+            live_requests[request_id] = sequence_group;
+            if (m_requests.find(request_id) == m_requests.end()) {
+                m_requests[request_id] = RequestInfo{m_step, m_num_arrived++, _get_prefix_key(sequence_group)};
+            }
+        }
+        for (auto it = m_requests.begin(); it != m_requests.end();) {
+            it = live_requests.count(it->first) ? std::next(it) : m_requests.erase(it);
+        }
+        for (auto it = m_prefix_owners.begin(); it != m_prefix_owners.end();) {
+            auto owner_it = live_requests.find(it->second);
+            bool is_computing = owner_it != live_requests.end() && _is_in_prompt_phase(owner_it->second);
+            it = is_computing ? std::next(it) : m_prefix_owners.erase(it);
+        }
+
+        // deferred groups whose prefix is no longer being computed can now restore it from the prefix cache
+        for (const auto& sequence_group : sequence_groups) {
+            auto& info = m_requests.at(sequence_group->get_request_id());
+            if (info.deferred && m_prefix_owners.count(*info.prefix_key) == 0) {
+                info.deferred = false;
+                if (!info.admitted && sequence_group->get_num_processed_tokens() == 0) {
+                    m_block_manager->restore_cached_blocks(sequence_group);
+                }
+            }
+        }
+
+        // 0 - admitted groups, 1 - aged waiting groups, 2 - other waiting groups
+        auto get_rank = [this](const SequenceGroup::Ptr& sequence_group) {
+            const auto& info = m_requests.at(sequence_group->get_request_id());
+            if (info.admitted || !_is_in_prompt_phase(sequence_group)) {
+                return 0;
+            }
+            return _is_aged(info) ? 1 : 2;
+        };
+        std::stable_sort(sequence_groups.begin(), sequence_groups.end(), [&](const SequenceGroup::Ptr& lhs, const SequenceGroup::Ptr& rhs) {
+            int lhs_rank = get_rank(lhs), rhs_rank = get_rank(rhs);
+            if (lhs_rank != rhs_rank || lhs_rank == 0) {
+                // admitted groups keep their relative order, since the sort is stable
+                return lhs_rank < rhs_rank;
+            }
+            if (lhs_rank == 2 && lhs->get_num_processed_tokens() != rhs->get_num_processed_tokens()) {
+                return lhs->get_num_processed_tokens() > rhs->get_num_processed_tokens();
+            }
+            return m_requests.at(lhs->get_request_id()).arrival_idx < m_requests.at(rhs->get_request_id()).arrival_idx;
+        });
+    }
+
+    bool is_deferred(const SequenceGroup::Ptr& sequence_group) override {
+        auto& info = m_requests.at(sequence_group->get_request_id());
+        if (info.admitted || _is_aged(info) || !info.prefix_key.has_value() || sequence_group->get_num_processed_tokens() > 0) {
+            return false;
+        }
+        auto owner_it = m_prefix_owners.find(*info.prefix_key);
+        if (owner_it == m_prefix_owners.end() || owner_it->second == sequence_group->get_request_id()) {
+            return false;
+        }
+        info.deferred = true;
+        return true;
+    }
+
+    void on_prompt_scheduled(const SequenceGroup::Ptr& sequence_group) override {
+        auto& info = m_requests.at(sequence_group->get_request_id());
+        info.admitted = true;
+        if (info.prefix_key.has_value() && sequence_group->get_num_processed_tokens() == 0) {
+            m_prefix_owners.emplace(*info.prefix_key, sequence_group->get_request_id());
+        }
+    }
+};
+
+}
@@ -5,12 +5,15 @@
 
 #include <memory>
 #include <list>
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <fstream>
 #include <chrono>
 
 #include "sequence_group.hpp"
+#include "continuous_batching/host_cache_store.hpp"
 
 namespace ov::genai {
 
@@ -20,8 +23,9 @@ class KVCacheBlock {
     size_t m_hash;
     std::chrono::time_point<std::chrono::steady_clock> m_timestamp;
 public:
-    using Ptr = std::shared_ptr<KVCacheBlock>;
-    using CPtr = std::shared_ptr<const KVCacheBlock>;
+    // blocks are owned by the BlockAllocator which creates them, block tables and prefix caches only refer to them
+    using Ptr = KVCacheBlock*;
+    using CPtr = const KVCacheBlock*;
 
     explicit KVCacheBlock(int index)
         : m_ref_count(0),
@@ -72,6 +76,19 @@ public:
 };
 
 using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
+// Maps prefix hashes to the blocks (one for each decoder layer) holding the KV cache for the corresponding prefix.
+// Since the hash of a block is chained with the hash of the previous block, this is a flattened prefix tree,
+// where each lookup is a single edge traversal.
+using PrefixHashToBlocksMap = std::unordered_map<uint64_t, BlocksPerLayer>;
+
+inline std::vector<size_t> get_block_indices(const BlocksPerLayer& blocks_for_all_layers) {
+    std::vector<size_t> block_indices;
+    block_indices.reserve(blocks_for_all_layers.size());
+    for (const auto& block : blocks_for_all_layers) {
+        block_indices.push_back(block->get_index());
+    }
+    return block_indices;
+}
 
 /**
  * @brief Allows to store and retrieve KV-cache blocks based on their content- and position-based hash.
@@ -80,8 +97,21 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    struct Entry {
+        BlocksPerLayer blocks_for_all_layers;
+        std::list<size_t>::iterator lru_it;
+    };
+    std::unordered_map<size_t, Entry> m_blocks;
+    // hashes in the order of addition to the store, front is the least recently used
+    std::list<size_t> m_lru;
     size_t m_num_layers;
+
+    BlocksPerLayer _erase(std::unordered_map<size_t, Entry>::iterator it) {
+        BlocksPerLayer blocks_for_all_layers = std::move(it->second.blocks_for_all_layers);
+        m_lru.erase(it->second.lru_it);
+        m_blocks.erase(it);
+        return blocks_for_all_layers;
+    }
     public:
     /**
      * Constructs the BlockHashStore.
@@ -91,6 +121,7 @@ class OverwritableBlocksHashStore {
 
     /**
      * Registers allocated KV cache blocks as overwritable. The blocks must not be owned by any sequence.
+     * The blocks become the most recently used ones in the store.
      * @param blocks_for_all_layers A vector of KV cache blocks (one for each decoder layer) to be added to the store.
      * The hash of each block across the vector must be identical.
      */
@@ -105,7 +136,8 @@ class OverwritableBlocksHashStore {
             }
         }
         OPENVINO_ASSERT(m_blocks.count(hash) == 0);
-        m_blocks[hash] = blocks_for_all_layers;
+        m_lru.push_back(hash);
+        m_blocks.emplace(hash, Entry{blocks_for_all_layers, std::prev(m_lru.end())});
     }
 
 
@@ -121,34 +153,36 @@ class OverwritableBlocksHashStore {
         {
             return {};
         }
-        BlocksPerLayer blocks_for_all_layers = it->second;
+        BlocksPerLayer blocks_for_all_layers = _erase(it);
         for (auto& block_ptr : blocks_for_all_layers) {
 
             block_ptr->set_timestamp(std::chrono::steady_clock::now());
             block_ptr->increment();
         }
-        m_blocks.erase(it);
         return blocks_for_all_layers;
     }
 
     /**
      * Pops the least recently used blocks from the store to be used and overwritten by another sequence.
      * Returned blocks will have reference counters equal to 1.
-     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store
-     * based on the timestamp.
+     *
+     * Block hashes are chained (the hash of a block depends on the hash of the previous block of the sequence), so the
+     * stored blocks form a prefix tree. A block is never freed before the blocks which continue its prefix, since any
+     * sequence owning a block also owns all of its preceding blocks, and the BlockManager frees the blocks of a sequence
+     * starting from the last one. Hence the least recently added block is always a leaf of this tree, and evicting it
+     * never leaves unreachable descendants in the store.
+     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store.
      */
     BlocksPerLayer get_lru_block_to_overwrite() {
         if (m_blocks.empty()) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
-        auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
+        BlocksPerLayer blocks_for_all_layers = _erase(m_blocks.find(m_lru.front()));
         auto timestamp = std::chrono::steady_clock::now();
         for (auto& block_ptr : blocks_for_all_layers) {
             block_ptr->set_timestamp(timestamp);
             block_ptr->increment();
         }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
         return blocks_for_all_layers;
     }
 
@@ -172,34 +206,124 @@ class OverwritableBlocksHashStore {
         for (uint64_t hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
-                retval.push_back(it->second);
-                m_blocks.erase(it);
+                retval.push_back(_erase(it));
             }
         }
         return retval;
     }
 
+    /**
+     * Calls `visitor` for each entry of the store, from the least to the most recently used one.
+     * @param visitor The function to be called with the hash and the blocks (one for each decoder layer) of each entry.
+     */
+    template <typename Visitor>
+    void for_each_block(Visitor&& visitor) const {
+        for (size_t hash : m_lru) {
+            visitor(hash, m_blocks.at(hash).blocks_for_all_layers);
+        }
+    }
+
     void clear() {
         m_blocks.clear();
+        m_lru.clear();
     }
 };
 
 class CacheStateDumper;
 
+/**
+ * @brief FIFO queue of free KV cache block indices stored in a flat ring buffer. Since each block is in the queue at
+ * most once, the buffer is sized to the total number of blocks and pushing or popping never allocates memory.
+ */
+class FreeBlockQueue {
+    std::vector<int> m_indices;
+    size_t m_head = 0;
+    size_t m_size = 0;
+
+public:
+    /**
+     * Changes the capacity of the queue, keeping the queued indices in their order.
+     * @param capacity The new capacity, must not be less than the number of queued indices.
+     */
+    void reserve(size_t capacity) {
+        OPENVINO_ASSERT(capacity >= m_size);
+        std::vector<int> indices(capacity);
+        for (size_t i = 0; i < m_size; ++i) {
+            indices[i] = m_indices[(m_head + i) % m_indices.size()];
+        }
+        m_indices.swap(indices);
+        m_head = 0;
+    }
+
+    void push_back(int block_idx) {
+        OPENVINO_ASSERT(m_size < m_indices.size(), "Free block queue overflow");
+        size_t tail = m_head + m_size;
+        if (tail >= m_indices.size()) {
+            tail -= m_indices.size();
+        }
+        m_indices[tail] = block_idx;
+        ++m_size;
+    }
+
+    int pop_front() {
+        OPENVINO_ASSERT(m_size > 0, "Free block queue is empty");
+        int block_idx = m_indices[m_head];
+        if (++m_head == m_indices.size()) {
+            m_head = 0;
+        }
+        --m_size;
+        return block_idx;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    void clear() {
+        m_indices.clear();
+        m_head = 0;
+        m_size = 0;
+    }
+};
+
 /**
  * @brief Maintains a pool of KV cache block descriptors (layered as configured at initialization), freeing or allocating
  * them as requested.
  */
 class BlockAllocator {
-    std::vector<std::list<KVCacheBlock::Ptr>> m_free_blocks;
-    // We keep m_free_blocks_num instead of m_free_blocks[X].size() to WA old CXX library implementation issue for std::list::size()
-    // see https://stackoverflow.com/questions/13157164/why-isnt-stdlist-size-constant-time
-    std::vector<size_t> m_free_blocks_num;
-    size_t m_total_num_blocks;
+    // descriptors of all blocks for each layer, indexed by the block index; a deque keeps their addresses stable
+    // when the pool grows
+    std::vector<std::deque<KVCacheBlock>> m_blocks;
+    // indices of the free blocks for each layer
+    std::vector<FreeBlockQueue> m_free_blocks;
+    size_t m_total_num_blocks = 0;
     friend class CacheStateDumper;
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
+    // optional second prefix cache tier for the contents of overwritten blocks
+    std::shared_ptr<HostKVCacheStore> m_host_cache_store;
+    // block copies between the device KV cache and m_host_cache_store to be executed by the CacheManager
+    std::vector<KVCacheBlockTransfer> m_pending_host_transfers;
+
+    void _add_blocks(size_t new_kv_blocks_count) {
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_free_blocks[layer_idx].reserve(new_kv_blocks_count);
+            for (int block_id = m_total_num_blocks; block_id < new_kv_blocks_count; ++block_id) {
+                m_blocks[layer_idx].emplace_back(block_id);
+                m_free_blocks[layer_idx].push_back(block_id);
+            }
+        }
+        m_total_num_blocks = new_kv_blocks_count;
+    }
+
+    void _push_free_block(const KVCacheBlock::Ptr& block_ptr, size_t layer_idx) {
+        m_free_blocks[layer_idx].push_back(block_ptr->get_index());
+    }
+
+    KVCacheBlock::Ptr _pop_free_block(size_t layer_idx) {
+        return &m_blocks[layer_idx][m_free_blocks[layer_idx].pop_front()];
+    }
 
 public:
     /**
@@ -211,41 +335,26 @@ public:
      * Blocks returned will be vectors with this size, each vector entry to be associated with a separate layer's KV cache.
      */
     BlockAllocator(size_t num_blocks, bool enable_prefix_caching, size_t num_layers = 1) :
-            m_total_num_blocks(num_blocks), m_num_layers(num_layers), m_enable_prefix_caching(enable_prefix_caching), m_overwriteable_blocks(num_layers) {
+            m_num_layers(num_layers), m_enable_prefix_caching(enable_prefix_caching), m_overwriteable_blocks(num_layers) {
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        m_blocks.resize(m_num_layers);
         m_free_blocks.resize(m_num_layers);
         if (num_blocks > 0) {
-            m_free_blocks_num = std::vector<size_t>(num_layers, num_blocks);
-            for (auto& per_layer_block_list : m_free_blocks) {
-                for (int block_id = 0; block_id < m_total_num_blocks; ++block_id) {
-                    per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-                }
-            }
-        } else {
-            m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
+            _add_blocks(num_blocks);
         }
     }
 
     ~BlockAllocator() {
         // sanity check to validate that all blocks are freed
-        for (auto& free_block : m_free_blocks_num) {
-            size_t free_and_overwritable_block_cnt = free_block + num_overwriteable_blocks();
+        for (auto& per_layer_free_blocks : m_free_blocks) {
+            size_t free_and_overwritable_block_cnt = per_layer_free_blocks.size() + num_overwriteable_blocks();
             OPENVINO_ASSERT(m_total_num_blocks == free_and_overwritable_block_cnt, "Expected num free blocks: ", m_total_num_blocks, ", actual: ", free_and_overwritable_block_cnt);
         }
     }
 
     void increase_kv_blocks_number(size_t new_kv_blocks_count) {
         OPENVINO_ASSERT(new_kv_blocks_count > m_total_num_blocks, "New blocks number should be more than previous blocks number.");
-        size_t added_blocks = new_kv_blocks_count - m_total_num_blocks;
-        for (auto idx = 0; idx < m_free_blocks_num.size(); idx++) {
-            m_free_blocks_num[idx] += added_blocks;
-        }
-        for (auto& per_layer_block_list : m_free_blocks) {
-            for (int block_id = m_total_num_blocks; block_id < new_kv_blocks_count; ++block_id) {
-                per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-            }
-        }
-        m_total_num_blocks = new_kv_blocks_count;
+        _add_blocks(new_kv_blocks_count);
     }
 
 
@@ -255,7 +364,7 @@ public:
      * @return Number of free blocks for this layer.
      */
     size_t num_free_blocks(size_t layer_idx) const {
-        return m_free_blocks_num[layer_idx] + num_overwriteable_blocks();
+        return m_free_blocks[layer_idx].size() + num_overwriteable_blocks();
     }
 
     /**
@@ -300,8 +409,7 @@ public:
         OPENVINO_ASSERT(layer_idx < m_num_layers);
         block_ptr->release();
         if (block_ptr->is_free()) {
-            m_free_blocks[layer_idx].push_back(block_ptr);
-            ++m_free_blocks_num[layer_idx];
+            _push_free_block(block_ptr, layer_idx);
         }
     }
 
@@ -312,7 +420,7 @@ public:
      * were computed.
      * @param blocks_for_all_layers The blocks to be freed (one for each layer).
      */
-    void free(const BlocksPerLayer& blocks_for_all_layers, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    void free(const BlocksPerLayer& blocks_for_all_layers, PrefixHashToBlocksMap& cached_blocks) {
         OPENVINO_ASSERT(blocks_for_all_layers.size() == m_num_layers);
         for (size_t i = 0; i < m_num_layers; i++) {
             auto& block_ptr = blocks_for_all_layers[i];
@@ -356,8 +464,7 @@ public:
 
                         // actual collision case
                         for (size_t layer_idx = 0; layer_idx < colliding_blocks_per_layer.size(); layer_idx++) {
-                            m_free_blocks[layer_idx].push_back(colliding_blocks_per_layer[layer_idx]);
-                            ++m_free_blocks_num[layer_idx];
+                            _push_free_block(colliding_blocks_per_layer[layer_idx], layer_idx);
                         }
 
                         // As block returns to free memory, it should be removed from cached_blocks.
@@ -379,15 +486,13 @@ public:
                     // This set of blocks to be freed corresponds to blocks from different time steps, and thus not eligible for caching
                     // TODO (vshampor): more fine-grained hash store control
                     for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                        m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                        ++m_free_blocks_num[layer_idx];
+                        _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                     }
                 }
             }
             else {
                 for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                    m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                    ++m_free_blocks_num[layer_idx];
+                    _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                 }
             }
         }
@@ -414,10 +519,8 @@ public:
         OPENVINO_ASSERT(layer_idx < m_free_blocks.size());
         OPENVINO_ASSERT(!m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1, layer_idx));
-        KVCacheBlock::Ptr allocated_block = m_free_blocks[layer_idx].front();
+        KVCacheBlock::Ptr allocated_block = _pop_free_block(layer_idx);
         allocated_block->increment();
-        m_free_blocks[layer_idx].pop_front();
-        --m_free_blocks_num[layer_idx];
         return allocated_block;
     }
 
@@ -432,21 +535,19 @@ public:
      * @return A vector of blocks (one for each layer), either freshly allocated or reused for overwriting,
      * or an empty vector if cache is exhausted.
      */
-    BlocksPerLayer allocate_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    BlocksPerLayer allocate_block(size_t hash, PrefixHashToBlocksMap& cached_blocks) {
         OPENVINO_ASSERT(m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1));
 
-        if (m_free_blocks_num[0] > 0) {
+        if (m_free_blocks[0].size() > 0) {
             // allocate new empty block
             BlocksPerLayer allocated_blocks;
             allocated_blocks.reserve(m_num_layers);
             for (size_t i = 0; i < m_num_layers; i++) {
-                KVCacheBlock::Ptr allocated_block = m_free_blocks[i].front();
+                KVCacheBlock::Ptr allocated_block = _pop_free_block(i);
                 allocated_block->increment();
                 allocated_block->set_hash(hash);
-                allocated_blocks.push_back(allocated_block);
-                m_free_blocks[i].pop_front();
-                --m_free_blocks_num[i];
+                allocated_blocks.push_back(std::move(allocated_block));
             }
             cached_blocks[hash] = allocated_blocks;
             return allocated_blocks;
@@ -456,6 +557,14 @@ public:
             BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
             cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
 
+            if (m_host_cache_store) {
+                // keep the contents of the overwritten block in the host tier
+                m_pending_host_transfers.push_back({KVCacheBlockTransfer::Direction::TO_HOST,
+                                                    blocks_for_all_layers[0]->get_hash(),
+                                                    get_block_indices(blocks_for_all_layers),
+                                                    {}});
+            }
+
             // update block with new hash
             for (auto& block : blocks_for_all_layers) {
                 block->set_hash(hash);
@@ -470,12 +579,14 @@ public:
     /**
      * Returns the blocks corresponding to a given hash either from the internal allocator store,
      * or from the supplied storage map, or nothing if there are no blocks corresponding to this hash.
+     * If a host cache store is set and has the contents for this hash, a block is allocated for them and
+     * the copy of the contents into the new block is scheduled (see `pull_host_transfers`).
      *
      * @param hash The hash of the blocks to be looked up.
      * @param cached_blocks The map of known hashes to already allocated and filled blocks.
      * @return A vector of blocks (one for each layer) corresponding to this hash, or an empty vector if the hash is not found in the map.
      */
-    BlocksPerLayer get_cached_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    BlocksPerLayer get_cached_block(size_t hash, PrefixHashToBlocksMap& cached_blocks) {
         auto blocks_for_all_layers = m_overwriteable_blocks.get_block_to_restore(hash);
         if (!blocks_for_all_layers.empty()) {
             // use cached block from internal store
@@ -491,9 +602,47 @@ public:
             }
             return blocks_for_all_layers;
         }
+        if (m_host_cache_store && can_allocate_blocks(1) && m_host_cache_store->contains(hash)) {
+            // use contents offloaded to the host tier
+            auto contents = m_host_cache_store->take(hash);
+            if (contents.has_value()) {
+                blocks_for_all_layers = allocate_block(hash, cached_blocks);
+                m_pending_host_transfers.push_back({KVCacheBlockTransfer::Direction::FROM_HOST,
+                                                    hash,
+                                                    get_block_indices(blocks_for_all_layers),
+                                                    std::move(*contents)});
+                return blocks_for_all_layers;
+            }
+        }
         return {};
     }
 
+    /**
+     * Sets the host store used as a second prefix cache tier. Can only be used if prefix caching is enabled.
+     * @param host_cache_store The store for the contents of the blocks overwritten in the device KV cache.
+     */
+    void set_host_cache_store(std::shared_ptr<HostKVCacheStore> host_cache_store) {
+        OPENVINO_ASSERT(m_enable_prefix_caching, "Host KV cache store can only be used with prefix caching enabled");
+        m_host_cache_store = std::move(host_cache_store);
+    }
+
+    /**
+     * @return The block copies between the device KV cache and the host cache store recorded since the last call,
+     * in the order in which they must be executed.
+     */
+    std::vector<KVCacheBlockTransfer> pull_host_transfers() {
+        std::vector<KVCacheBlockTransfer> retval;
+        retval.swap(m_pending_host_transfers);
+        return retval;
+    }
+
+    /**
+     * @return The store of the freed blocks which are kept for their contents to be reused.
+     */
+    const OverwritableBlocksHashStore& get_overwriteable_blocks() const {
+        return m_overwriteable_blocks;
+    }
+
     /**
      * @return The percentage of the allocator's free block pool utilization.
      */
@@ -512,9 +661,9 @@ public:
 
     void clear() {
         m_total_num_blocks = 0;
-        m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
-        for (auto& per_layer_block_list : m_free_blocks) {
-            per_layer_block_list.clear();
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_blocks[layer_idx].clear();
+            m_free_blocks[layer_idx].clear();
         }
         m_overwriteable_blocks.clear();
     }
@@ -532,8 +681,7 @@ class BlockManager {
     bool m_enable_prefix_caching;
     size_t m_block_size;
     size_t m_num_layers;
-    // TODO: caching time can probably be improved if we use the prefix tree
-    std::map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
+    PrefixHashToBlocksMap m_prefix_hash_to_occupied_block_map;
 
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
@@ -822,7 +970,9 @@ public:
         auto& block_table = m_block_table[seq_id];
         size_t effective_num_layers = block_table.size();
         size_t num_allocated_blocks = block_table[0].size();
-        for (size_t i = 0; i < num_allocated_blocks; i++) {
+        // free starting from the last block, so that in the overwritable block store the blocks continuing a prefix
+        // are less recently used than the blocks of the prefix itself
+        for (size_t i = num_allocated_blocks; i-- > 0;) {
             BlocksPerLayer blocks_to_free;
             blocks_to_free.reserve(effective_num_layers);
             for (size_t layer_idx = 0; layer_idx < effective_num_layers; layer_idx++) {
@@ -1167,6 +1317,40 @@ public:
         }
     }
 
+    /**
+     * Sets the host store used as a second prefix cache tier for the blocks that are overwritten in the device KV cache.
+     * @param host_cache_store The host cache store.
+     */
+    void set_host_cache_store(std::shared_ptr<HostKVCacheStore> host_cache_store) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        m_allocator.set_host_cache_store(std::move(host_cache_store));
+    }
+
+    /**
+     * @return The block copies between the device KV cache and the host cache store to be executed by the CacheManager
+     * before the next inference, in the order in which they must be executed.
+     */
+    std::vector<KVCacheBlockTransfer> pull_host_transfers() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        return m_allocator.pull_host_transfers();
+    }
+
+    /**
+     * @return Physical block indices (one for each layer) of all blocks with contents known by their prefix hash,
+     * both occupied by sequences and kept for reuse, keyed by the hash.
+     */
+    std::map<uint64_t, std::vector<size_t>> get_hashed_blocks() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::map<uint64_t, std::vector<size_t>> hashed_blocks;
+        for (const auto& [hash, blocks_for_all_layers] : m_prefix_hash_to_occupied_block_map) {
+            hashed_blocks[hash] = get_block_indices(blocks_for_all_layers);
+        }
+        m_allocator.get_overwriteable_blocks().for_each_block([&hashed_blocks](size_t hash, const BlocksPerLayer& blocks_for_all_layers) {
+            hashed_blocks[hash] = get_block_indices(blocks_for_all_layers);
+        });
+        return hashed_blocks;
+    }
+
     void clear() {
         // KV-cache should not be cleared if prefix caching is enabled
         OPENVINO_ASSERT(m_enable_prefix_caching == false);
@@ -8,6 +8,7 @@
 
 #include "openvino/runtime/tensor.hpp"
 #include "utils.hpp"
+#include "continuous_batching/host_cache_store.hpp"
 namespace ov::genai {
 
 class CacheManager {
@@ -26,6 +27,42 @@ class CacheManager {
         return pshape.get_shape();
     }
 
+    void copy_block_between_host(ov::Tensor& cache, size_t block_id, ov::Tensor& host_block, bool to_host) {
+        ov::Shape cache_shape = cache.get_shape();
+        ov::Coordinate start_roi(cache_shape.size(), 0);
+        ov::Coordinate end_roi = cache_shape;
+        end_roi[0] = (start_roi[0] = block_id) + 1;
+
+        if (cache.is<ov::RemoteTensor>()) {
+            ov::RemoteTensor cache_roi(cache, start_roi, end_roi);
+            if (to_host) {
+                cache_roi.copy_to(host_block);
+            } else {
+                cache_roi.copy_from(host_block);
+            }
+            return;
+        }
+
+        const auto& cache_prec = cache.get_element_type();
+        if (cache_prec == ov::element::u4 || cache_prec == ov::element::i4) {
+            size_t stride = host_block.get_byte_size();
+            uint8_t* cache_ptr = reinterpret_cast<uint8_t*>(cache.data()) + block_id * stride;
+            uint8_t* host_ptr = reinterpret_cast<uint8_t*>(host_block.data());
+            if (to_host) {
+                std::memcpy(host_ptr, cache_ptr, stride);
+            } else {
+                std::memcpy(cache_ptr, host_ptr, stride);
+            }
+        } else {
+            ov::Tensor cache_roi(cache, start_roi, end_roi);
+            if (to_host) {
+                cache_roi.copy_to(host_block);
+            } else {
+                host_block.copy_to(cache_roi);
+            }
+        }
+    }
+
     void update_request_tensor(size_t decoder_layer_id) {
         m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
@@ -301,6 +338,106 @@ public:
         }
     }
 
+    /**
+     * @return Shapes of a single key cache block, one for each decoder layer.
+     */
+    std::vector<ov::Shape> get_key_block_shapes() const {
+        std::vector<ov::Shape> key_shapes;
+        key_shapes.reserve(m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            key_shapes.push_back(set_kv_blocks(m_key_shapes[decoder_layer_id], 1));
+        }
+        return key_shapes;
+    }
+
+    /**
+     * @return Shapes of a single value cache block, one for each decoder layer.
+     */
+    std::vector<ov::Shape> get_value_block_shapes() const {
+        std::vector<ov::Shape> value_shapes;
+        value_shapes.reserve(m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            value_shapes.push_back(set_kv_blocks(m_value_shapes[decoder_layer_id], 1));
+        }
+        return value_shapes;
+    }
+
+    const std::vector<ov::element::Type>& get_key_cache_precisions() const {
+        return m_key_precisions;
+    }
+
+    const std::vector<ov::element::Type>& get_value_cache_precisions() const {
+        return m_value_precisions;
+    }
+
+    /**
+     * Creates a host store for the contents of the KV cache blocks in the layout of this CacheManager's KV cache.
+     * @param max_ram_blocks Maximum number of blocks to be kept in host memory.
+     * @param spill_dir Directory to spill the blocks evicted from host memory to. Empty path disables spilling.
+     * @param max_disk_blocks Maximum number of blocks to be kept in `spill_dir`.
+     */
+    std::shared_ptr<HostKVCacheStore> create_host_cache_store(size_t max_ram_blocks, const std::filesystem::path& spill_dir = {}, size_t max_disk_blocks = 0) const {
+        return std::make_shared<HostKVCacheStore>(m_key_precisions, get_key_block_shapes(), m_value_precisions, get_value_block_shapes(),
+                                                  max_ram_blocks, spill_dir, max_disk_blocks);
+    }
+
+    /**
+     * @return Host tensors sized to hold the contents of a single KV cache block for all decoder layers.
+     */
+    HostKVCacheBlock allocate_host_block() const {
+        HostKVCacheBlock host_block;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            host_block.key_blocks.emplace_back(m_key_precisions[decoder_layer_id], set_kv_blocks(m_key_shapes[decoder_layer_id], 1));
+            host_block.value_blocks.emplace_back(m_value_precisions[decoder_layer_id], set_kv_blocks(m_value_shapes[decoder_layer_id], 1));
+        }
+        return host_block;
+    }
+
+    /**
+     * Copies the contents of a KV cache block to host memory.
+     * @param block_indices Physical block index for each decoder layer.
+     * @param host_block Destination host tensors, e.g. allocated by HostKVCacheStore::allocate_block.
+     */
+    void copy_block_to_host(const std::vector<size_t>& block_indices, HostKVCacheBlock& host_block) {
+        OPENVINO_ASSERT(block_indices.size() == m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            size_t block_id = block_indices[decoder_layer_id];
+            copy_block_between_host(m_key_cache[decoder_layer_id], block_id, host_block.key_blocks[decoder_layer_id], true);
+            copy_block_between_host(m_value_cache[decoder_layer_id], block_id, host_block.value_blocks[decoder_layer_id], true);
+        }
+    }
+
+    /**
+     * Copies the contents of a KV cache block from host memory.
+     * @param block_indices Physical block index for each decoder layer.
+     * @param host_block Source host tensors.
+     */
+    void copy_block_from_host(const std::vector<size_t>& block_indices, HostKVCacheBlock& host_block) {
+        OPENVINO_ASSERT(block_indices.size() == m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            size_t block_id = block_indices[decoder_layer_id];
+            copy_block_between_host(m_key_cache[decoder_layer_id], block_id, host_block.key_blocks[decoder_layer_id], false);
+            copy_block_between_host(m_value_cache[decoder_layer_id], block_id, host_block.value_blocks[decoder_layer_id], false);
+        }
+    }
+
+    /**
+     * Executes the block copies between the KV cache and the host store in the order of their recording.
+     * @param transfers The block copies recorded by the BlockManager.
+     * @param host_cache_store The host store which receives the offloaded block contents.
+     */
+    void copy_blocks_between_host(std::vector<KVCacheBlockTransfer>& transfers, HostKVCacheStore& host_cache_store) {
+        for (auto& transfer : transfers) {
+            if (transfer.direction == KVCacheBlockTransfer::Direction::TO_HOST) {
+                HostKVCacheBlock host_block = host_cache_store.allocate_block();
+                copy_block_to_host(transfer.block_indices, host_block);
+                host_cache_store.put(transfer.hash, std::move(host_block));
+            } else {
+                copy_block_from_host(transfer.block_indices, transfer.contents);
+            }
+        }
+    }
+
     void clear() {
         for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
             m_key_cache[decoder_layer_id] = ov::Tensor();
@@ -0,0 +1,296 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Contents of a single KV cache block copied out of the device KV cache, one tensor per decoder layer for
+ * keys and for values. Each tensor has the shape of the corresponding device cache with the block dimension set to 1.
+ */
+struct HostKVCacheBlock {
+    std::vector<ov::Tensor> key_blocks;
+    std::vector<ov::Tensor> value_blocks;
+};
+
+/**
+ * @brief Describes a pending copy of a KV cache block between the device KV cache and the host store.
+ * Transfers are recorded by the BlockAllocator while blocks are being assigned and are executed in the recorded
+ * order by the CacheManager before the next inference.
+ */
+struct KVCacheBlockTransfer {
+    enum class Direction {
+        TO_HOST,   // save the block contents to the host store under `hash` before the block is overwritten
+        FROM_HOST  // write the `contents` taken from the host store into the freshly assigned block
+    };
+    Direction direction;
+    size_t hash;
+    // physical block index for each layer
+    std::vector<size_t> block_indices;
+    // only set for Direction::FROM_HOST
+    HostKVCacheBlock contents;
+};
+
+/**
+ * @brief A second tier for the prefix cache, which keeps the contents of hashed KV cache blocks after their
+ * device blocks have been overwritten by other sequences. Blocks are kept in host memory up to a configured limit,
+ * least recently used blocks are then either spilled to files in a configured directory or dropped.
+ * Accessed both from add_request (lookups) and from the scheduling step (offloads), hence guarded by a mutex.
+ */
+class HostKVCacheStore {
+    using LRUList = std::list<size_t>;
+
+    struct RAMEntry {
+        HostKVCacheBlock block;
+        LRUList::iterator lru_it;
+    };
+
+    std::vector<ov::element::Type> m_key_precisions, m_value_precisions;
+    std::vector<ov::Shape> m_key_shapes, m_value_shapes;
+
+    size_t m_max_ram_blocks;
+    std::filesystem::path m_spill_dir;
+    size_t m_max_disk_blocks;
+
+    // front is the least recently used entry
+    LRUList m_ram_lru;
+    std::unordered_map<size_t, RAMEntry> m_ram_blocks;
+    LRUList m_disk_lru;
+    std::unordered_map<size_t, LRUList::iterator> m_disk_blocks;
+
+    mutable std::mutex m_mutex;
+
+    std::filesystem::path _get_spill_path(size_t hash) const {
+        return m_spill_dir / ("kv_block_" + std::to_string(hash) + ".bin");
+    }
+
+    void _spill_to_disk(size_t hash, const HostKVCacheBlock& block) {
+        if (m_max_disk_blocks == 0) {
+            return;
+        }
+        auto disk_it = m_disk_blocks.find(hash);
+        if (disk_it != m_disk_blocks.end()) {
+            m_disk_lru.erase(disk_it->second);
+            m_disk_blocks.erase(disk_it);
+        }
+        while (m_disk_blocks.size() >= m_max_disk_blocks) {
+            size_t lru_hash = m_disk_lru.front();
+            m_disk_lru.pop_front();
+            m_disk_blocks.erase(lru_hash);
+            std::error_code ec;
+            std::filesystem::remove(_get_spill_path(lru_hash), ec);
+        }
+
+        std::ofstream file(_get_spill_path(hash), std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            // spilling is best-effort, the block is simply dropped from the store
+            return;
+        }
+        auto write_tensors = [&file](const std::vector<ov::Tensor>& tensors) {
+            for (const auto& tensor : tensors) {
+                file.write(static_cast<const char*>(tensor.data()), tensor.get_byte_size());
+            }
+        };
+        write_tensors(block.key_blocks);
+        write_tensors(block.value_blocks);
+        if (!file.good()) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(_get_spill_path(hash), ec);
+            return;
+        }
+        m_disk_lru.push_back(hash);
+        m_disk_blocks[hash] = std::prev(m_disk_lru.end());
+    }
+
+    std::optional<HostKVCacheBlock> _read_spilled(size_t hash) const {
+        HostKVCacheBlock block = allocate_block();
+        std::ifstream file(_get_spill_path(hash), std::ios::binary);
+        if (!file.is_open()) {
+            return std::nullopt;
+        }
+        auto read_tensors = [&file](std::vector<ov::Tensor>& tensors) {
+            for (auto& tensor : tensors) {
+                file.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+            }
+        };
+        read_tensors(block.key_blocks);
+        read_tensors(block.value_blocks);
+        if (!file.good()) {
+            return std::nullopt;
+        }
+        return block;
+    }
+
+    std::optional<HostKVCacheBlock> _load_from_disk(size_t hash) {
+        auto disk_it = m_disk_blocks.find(hash);
+        if (disk_it == m_disk_blocks.end()) {
+            return std::nullopt;
+        }
+        m_disk_lru.erase(disk_it->second);
+        m_disk_blocks.erase(disk_it);
+
+        auto block = _read_spilled(hash);
+        std::error_code ec;
+        std::filesystem::remove(_get_spill_path(hash), ec);
+        return block;
+    }
+
+public:
+    /**
+     * Constructs the HostKVCacheStore.
+     * @param key_precisions Precisions of the key caches, one for each decoder layer.
+     * @param key_shapes Shapes of a single key cache block, one for each decoder layer.
+     * @param value_precisions Precisions of the value caches, one for each decoder layer.
+     * @param value_shapes Shapes of a single value cache block, one for each decoder layer.
+     * @param max_ram_blocks Maximum number of blocks to be kept in host memory.
+     * @param spill_dir Directory to spill the blocks evicted from host memory to. Empty path disables spilling.
+     * @param max_disk_blocks Maximum number of blocks to be kept in `spill_dir`.
+     */
+    HostKVCacheStore(std::vector<ov::element::Type> key_precisions,
+                     std::vector<ov::Shape> key_shapes,
+                     std::vector<ov::element::Type> value_precisions,
+                     std::vector<ov::Shape> value_shapes,
+                     size_t max_ram_blocks,
+                     const std::filesystem::path& spill_dir = {},
+                     size_t max_disk_blocks = 0) :
+        m_key_precisions(std::move(key_precisions)),
+        m_value_precisions(std::move(value_precisions)),
+        m_key_shapes(std::move(key_shapes)),
+        m_value_shapes(std::move(value_shapes)),
+        m_max_ram_blocks(max_ram_blocks),
+        m_spill_dir(spill_dir),
+        m_max_disk_blocks(spill_dir.empty() ? 0 : max_disk_blocks) {
+        OPENVINO_ASSERT(m_key_precisions.size() == m_key_shapes.size() && m_value_precisions.size() == m_value_shapes.size() &&
+                        m_key_shapes.size() == m_value_shapes.size(), "Key and value cache descriptions must be given for each decoder layer");
+        if (m_max_disk_blocks > 0) {
+            std::filesystem::create_directories(m_spill_dir);
+        }
+    }
+
+    ~HostKVCacheStore() {
+        for (size_t hash : m_disk_lru) {
+            std::error_code ec;
+            std::filesystem::remove(_get_spill_path(hash), ec);
+        }
+    }
+
+    HostKVCacheStore(const HostKVCacheStore&) = delete;
+    HostKVCacheStore& operator=(const HostKVCacheStore&) = delete;
+
+    /**
+     * @return Host tensors sized to hold the contents of a single KV cache block for all decoder layers.
+     */
+    HostKVCacheBlock allocate_block() const {
+        HostKVCacheBlock block;
+        block.key_blocks.reserve(m_key_shapes.size());
+        block.value_blocks.reserve(m_value_shapes.size());
+        for (size_t layer_idx = 0; layer_idx < m_key_shapes.size(); layer_idx++) {
+            block.key_blocks.emplace_back(m_key_precisions[layer_idx], m_key_shapes[layer_idx]);
+            block.value_blocks.emplace_back(m_value_precisions[layer_idx], m_value_shapes[layer_idx]);
+        }
+        return block;
+    }
+
+    /**
+     * Stores the contents of a block under a given hash, replacing the previous contents stored under this hash.
+     * If the host memory limit is exceeded, least recently used blocks are spilled to disk or dropped.
+     * @param hash The prefix hash of the block contents.
+     * @param block The block contents.
+     */
+    void put(size_t hash, HostKVCacheBlock block) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_max_ram_blocks == 0) {
+            _spill_to_disk(hash, block);
+            return;
+        }
+        auto it = m_ram_blocks.find(hash);
+        if (it != m_ram_blocks.end()) {
+            m_ram_lru.erase(it->second.lru_it);
+            m_ram_blocks.erase(it);
+        }
+        m_ram_lru.push_back(hash);
+        m_ram_blocks[hash] = RAMEntry{std::move(block), std::prev(m_ram_lru.end())};
+
+        while (m_ram_blocks.size() > m_max_ram_blocks) {
+            size_t lru_hash = m_ram_lru.front();
+            m_ram_lru.pop_front();
+            auto lru_it = m_ram_blocks.find(lru_hash);
+            _spill_to_disk(lru_hash, lru_it->second.block);
+            m_ram_blocks.erase(lru_it);
+        }
+    }
+
+    /**
+     * @param hash The prefix hash to look up.
+     * @return Whether the contents for this hash are present in the store.
+     */
+    bool contains(size_t hash) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_ram_blocks.count(hash) > 0 || m_disk_blocks.count(hash) > 0;
+    }
+
+    /**
+     * Removes the contents stored under a given hash from the store and returns them.
+     * @param hash The prefix hash to look up.
+     * @return The block contents, or std::nullopt if the hash is not present in the store.
+     */
+    std::optional<HostKVCacheBlock> take(size_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_ram_blocks.find(hash);
+        if (it != m_ram_blocks.end()) {
+            HostKVCacheBlock block = std::move(it->second.block);
+            m_ram_lru.erase(it->second.lru_it);
+            m_ram_blocks.erase(it);
+            return block;
+        }
+        return _load_from_disk(hash);
+    }
+
+    /**
+     * Calls `visitor` for each block in the store, including the blocks spilled to disk. Does not affect the LRU order.
+     * @param visitor The function to be called with the hash and the contents of each block.
+     */
+    void for_each_block(const std::function<void(size_t, const HostKVCacheBlock&)>& visitor) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [hash, entry] : m_ram_blocks) {
+            visitor(hash, entry.block);
+        }
+        for (const auto& [hash, lru_it] : m_disk_blocks) {
+            auto block = _read_spilled(hash);
+            if (block.has_value()) {
+                visitor(hash, *block);
+            }
+        }
+    }
+
+    /**
+     * @return Number of blocks currently kept in host memory.
+     */
+    size_t num_ram_blocks() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_ram_blocks.size();
+    }
+
+    /**
+     * @return Number of blocks currently spilled to disk.
+     */
+    size_t num_disk_blocks() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_disk_blocks.size();
+    }
+};
+
+}
@@ -242,6 +242,9 @@ class ModelRunner {
     ov::Tensor m_cached_token_type_ids;
     ov::Tensor m_cached_deepstack_visual_embeds;
     ov::Tensor m_cached_visual_pos_masks;
+
+    // index of the LoRA adapters row for each scheduled sequence group, set if adapters are applied per request
+    std::vector<int32_t> m_lora_adapter_rows;
 public:
     /**
      * Constructs the ModelRunner.
@@ -294,6 +297,15 @@ public:
     void enable_hidden_state_import(bool on)   { on ? m_hidden_state_flags |= HS_IMPORT   : m_hidden_state_flags &= ~HS_IMPORT; }
     void enable_hidden_state_internal(bool on) { on ? m_hidden_state_flags |= HS_INTERNAL : m_hidden_state_flags &= ~HS_INTERNAL; }
 
+    /**
+     * Sets the indices of the LoRA adapter rows to be passed to the model for the tokens of each scheduled sequence group
+     * during the next `forward` call, in the order of the scheduled sequence groups.
+     * @param lora_adapter_rows Indices returned by AdapterController::apply_per_request.
+     */
+    void set_lora_adapter_rows(std::vector<int32_t> lora_adapter_rows) {
+        m_lora_adapter_rows = std::move(lora_adapter_rows);
+    }
+
     void set_inputs_embedder(const std::shared_ptr<InputsEmbedder>& inputs_embedder) {
         m_inputs_embedder = inputs_embedder;
         m_embedding = inputs_embedder->get_embedding_model();
@@ -465,6 +477,15 @@ public:
             matmul_gathering_is_available = true;
         } catch (const ov::Exception&) {}
 
+        int32_t* lora_adapter_indices_data = nullptr;
+        if (!m_lora_adapter_rows.empty()) {
+            OPENVINO_ASSERT(m_lora_adapter_rows.size() == num_sequence_groups,
+                            "LoRA adapter rows are expected for each scheduled sequence group");
+            ov::Tensor lora_adapter_indices = m_request.get_tensor("lora_adapter_indices");
+            lora_adapter_indices.set_shape({total_num_tokens});
+            lora_adapter_indices_data = lora_adapter_indices.data<int32_t>();
+        }
+
         size_t current_token_idx = 0;
         std::map<size_t, std::set<size_t>> seq_id_to_skipped_blocks_map;
         size_t position_ids_idx = 0;
@@ -646,6 +667,9 @@ public:
                         *score_aggregation_window_data = 1;
                     }
                 }
+                if (lora_adapter_indices_data) {
+                    std::fill_n(lora_adapter_indices_data + current_token_idx, num_scheduled_tokens, m_lora_adapter_rows[i]);
+                }
                 current_token_idx += num_scheduled_tokens;
                 past_lens_data += 1;
                 subsequence_begins_data += 1;
@@ -15,6 +15,7 @@
 #include "speculative_decoding/continuous_batching/eagle3_strategy.hpp"
 #include "speculative_decoding/continuous_batching/fast_draft_strategy.hpp"
 #include "speculative_decoding/eagle3_model_transforms.hpp"
+#include "speculative_decoding/layer_skip_model_transforms.hpp"
 #include "utils.hpp"
 #include "visual_language/inputs_embedder.hpp"
 #include "json_utils.hpp"
@@ -33,6 +34,31 @@ extract_prompt_lookup_from_config(ov::AnyMap& config) {
     return res;
 }
 
+size_t
+extract_self_speculative_draft_layers_from_config(ov::AnyMap& config) {
+    size_t num_draft_layers = 0;
+    if (config.find(ov::genai::self_speculative_draft_layers.name()) != config.end()) {
+        num_draft_layers = config.at(ov::genai::self_speculative_draft_layers.name()).as<size_t>();
+        config.erase(ov::genai::self_speculative_draft_layers.name());
+    }
+    return num_draft_layers;
+}
+
+// draft model of self-speculative decoding shares device and properties with the main model; it is a separate pipeline
+// with a KV cache of its own for the kept layers, the KV cache blocks of the main model are not shared
+void create_self_speculative_draft_model(size_t num_draft_layers,
+                                         const std::shared_ptr<ov::Model>& model,
+                                         const Tokenizer& tokenizer,
+                                         const std::string& device,
+                                         const ov::genai::GenerationConfig& generation_config,
+                                         ModelDesc& draft_model_desc) {
+    if (num_draft_layers == 0) {
+        return;
+    }
+    OPENVINO_ASSERT(draft_model_desc.model == nullptr, "Self-speculative decoding and speculative decoding with a draft model are mutually exclusive");
+    draft_model_desc = ModelDesc(utils::layer_skip::create_draft_model(model, num_draft_layers), tokenizer, device, {}, {}, generation_config);
+}
+
 float get_load_time(std::chrono::steady_clock::time_point start_time) {
     auto stop_time = std::chrono::steady_clock::now();
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -49,6 +75,7 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = utils::extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
     auto eagle_rt_info = utils::eagle3::extract_eagle3_info_from_config(draft_model_desr.properties, models_path);
 
     auto model = utils::read_model(models_path, properties);
@@ -56,6 +83,7 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     properties_without_draft_model_without_gguf[ov::cache_model_path.name()] = models_path;
     auto tokenizer = ov::genai::Tokenizer(models_path, tokenizer_properties);
     auto generation_config = utils::from_config_json_if_exists(models_path);
+    create_self_speculative_draft_model(num_self_speculative_draft_layers, model, tokenizer, device, generation_config, draft_model_desr);
 
     std::shared_ptr<InputsEmbedder> embedder;
     if (std::filesystem::exists(models_path / "openvino_text_embeddings_model.xml")) {
@@ -99,12 +127,14 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = utils::extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
     auto eagle_rt_info = utils::eagle3::extract_eagle3_info_from_config(draft_model_desr.properties, models_path);
     auto model = utils::read_model(models_path, properties_without_draft_model);
     auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model);
     properties_without_draft_model_without_gguf[ov::cache_model_path.name()] = models_path;
 
     auto generation_config = utils::from_config_json_if_exists(models_path);
+    create_self_speculative_draft_model(num_self_speculative_draft_layers, model, tokenizer, device, generation_config, draft_model_desr);
     std::shared_ptr<InputsEmbedder> embedder;
     if (std::filesystem::exists(models_path / "openvino_text_embeddings_model.xml")) {
         embedder = std::make_shared<InputsEmbedder>(models_path, device, properties_without_draft_model_without_gguf);
@@ -149,8 +179,10 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = utils::extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
     auto eagle_rt_info = utils::eagle3::extract_eagle3_info_from_config(draft_model_desr.properties, std::filesystem::path(model_str));
     auto model = utils::singleton_core().read_model(model_str, weights_tensor);
+    create_self_speculative_draft_model(num_self_speculative_draft_layers, model, tokenizer, device, generation_config, draft_model_desr);
 
     auto rt_info = model->get_rt_info();
     std::shared_ptr<InputsEmbedder> embedder = nullptr;
@@ -199,8 +231,10 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = utils::extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto num_self_speculative_draft_layers = extract_self_speculative_draft_layers_from_config(properties_without_draft_model);
     auto model_pair = utils::get_model_weights_pair(models_map, "language");
     auto model = utils::singleton_core().read_model(model_pair.first, model_pair.second);
+    create_self_speculative_draft_model(num_self_speculative_draft_layers, model, tokenizer, device, generation_config, draft_model_desr);
 
     auto rt_info = model->get_rt_info();
     std::filesystem::path directory;
@@ -354,3 +388,11 @@ void ContinuousBatchingPipeline::start_chat(const std::string& system_message) {
 void ContinuousBatchingPipeline::finish_chat() {
     m_impl->finish_chat();
 }
+
+void ContinuousBatchingPipeline::save_prefix_cache(const std::filesystem::path& path) {
+    m_impl->save_prefix_cache(path);
+}
+
+bool ContinuousBatchingPipeline::load_prefix_cache(const std::filesystem::path& path) {
+    return m_impl->load_prefix_cache(path);
+}
@@ -65,6 +65,14 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::finish_chat() {
     m_video_id = 0;
 };
 
+void ContinuousBatchingPipeline::IContinuousBatchingPipeline::save_prefix_cache(const std::filesystem::path&) {
+    OPENVINO_THROW("Prefix cache snapshots are not supported by this pipeline");
+}
+
+bool ContinuousBatchingPipeline::IContinuousBatchingPipeline::load_prefix_cache(const std::filesystem::path&) {
+    OPENVINO_THROW("Prefix cache snapshots are not supported by this pipeline");
+}
+
 std::vector<GenerationResult>
 ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     const std::vector<std::string>& prompts,
@@ -191,6 +191,16 @@ public:
      */
     void finish_chat();
 
+    /**
+     * Writes the prefix cache into a snapshot file
+     */
+    virtual void save_prefix_cache(const std::filesystem::path& path);
+
+    /**
+     * Loads the prefix cache from a snapshot file, returns false if the snapshot does not match the pipeline
+     */
+    virtual bool load_prefix_cache(const std::filesystem::path& path);
+
     ~IContinuousBatchingPipeline();
 };
 }
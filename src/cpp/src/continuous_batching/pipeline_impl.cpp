@@ -20,6 +20,8 @@
 #include "continuous_batching/paged_attention_transformations.hpp"
 #include "lora/helper.hpp"
 #include "continuous_batching/cache_state_dumper.hpp"
+#include "continuous_batching/prefix_cache_snapshot.hpp"
+#include "logger.hpp"
 
 namespace {
 
@@ -133,6 +135,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
         m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        m_is_per_request_adapters = m_generation_config.adapters->get_mode() == AdapterConfig::MODE_PER_REQUEST;
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
@@ -142,6 +145,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
 
+    if (scheduler_config.enable_prefix_caching) {
+        // identifies the model the prefix cache snapshots are made for
+        m_model_fingerprint = compute_model_fingerprint(model);
+    }
+
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
     std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
     const bool all_gpu_device =
@@ -225,6 +233,14 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
         m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
+
+    if (normalized_config.enable_prefix_caching && !normalized_config.prefix_cache_snapshot_path.empty() &&
+        std::filesystem::exists(normalized_config.prefix_cache_snapshot_path)) {
+        if (!load_prefix_cache(normalized_config.prefix_cache_snapshot_path)) {
+            GENAI_WARN("Prefix cache snapshot %s was made for a different model or KV-cache configuration and is ignored",
+                       normalized_config.prefix_cache_snapshot_path.c_str());
+        }
+    }
 };
 
 
@@ -306,6 +322,11 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
                                                          token_type_ids);
     }
 
+    if (m_is_per_request_adapters) {
+        // KV blocks computed with different adapters must not be reused from the prefix cache
+        sequence_group->set_prefix_hash_salt(m_adapter_controller->get_per_request_id(sampling_params_copy.adapters));
+    }
+
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
@@ -344,6 +365,18 @@ bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_reques
     return !m_awaiting_requests.empty() || !m_requests.empty();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::save_prefix_cache(const std::filesystem::path& path) {
+    OPENVINO_ASSERT(m_scheduler->get_config().enable_prefix_caching, "Prefix cache can only be saved if prefix caching is enabled");
+    OPENVINO_ASSERT(!has_non_finished_requests(), "Prefix cache can only be saved when there are no requests in progress");
+    m_scheduler->save_prefix_cache(path, m_model_fingerprint);
+}
+
+bool ContinuousBatchingPipeline::ContinuousBatchingImpl::load_prefix_cache(const std::filesystem::path& path) {
+    OPENVINO_ASSERT(m_scheduler->get_config().enable_prefix_caching, "Prefix cache can only be loaded if prefix caching is enabled");
+    OPENVINO_ASSERT(!has_non_finished_requests(), "Prefix cache can only be loaded when there are no requests in progress");
+    return m_scheduler->load_prefix_cache(path, m_model_fingerprint);
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     static ManualTimer step_timer("step()");
     step_timer.start();
@@ -357,6 +390,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         scheduling_timer.start();
         scheduler_output = m_scheduler->schedule(m_requests);
         scheduling_timer.end();
+        m_num_scheduled_tokens = scheduler_output.m_total_num_scheduled_tokens;
 
         m_pipeline_metrics.kv_cache_size_in_bytes = scheduler_output.m_cache_size_in_bytes;
         m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
@@ -390,6 +424,16 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     }
     ov::Tensor logits;
 
+    if (m_is_per_request_adapters) {
+        std::vector<std::optional<AdapterConfig>> adapters;
+        adapters.reserve(scheduler_output.m_scheduled_sequence_groups_ids.size());
+        for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+            adapters.push_back(m_requests[seq_group_id]->get_sampling_parameters().adapters);
+        }
+        m_model_runner->set_lora_adapter_rows(
+            m_adapter_controller->apply_per_request(m_model_runner->get_infer_request(), adapters));
+    }
+
     {
         static ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
@@ -397,6 +441,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         logits = m_model_runner->forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
+        m_scheduler->register_inference(scheduler_output.m_total_num_scheduled_tokens, infer_end - infer_start);
         timer.end();
     }
 
@@ -479,7 +524,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std::optional<AdapterConfig>& adapters) {
-    if (m_adapter_controller) {
+    // adapters of each request are applied in each step
+    if (m_adapter_controller && !m_is_per_request_adapters) {
         m_adapter_controller->apply(m_model_runner->get_infer_request(), adapters);
     }
 }
@@ -512,12 +558,14 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    // checks that all requests has the same LoRA adapters property value, unless adapters are applied per request in each step
+    if (!m_is_per_request_adapters) {
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests");
+        }
+        set_adapters(sampling_params[0].adapters);
     }
-    set_adapters(sampling_params[0].adapters);
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
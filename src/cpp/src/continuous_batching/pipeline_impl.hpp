@@ -16,6 +16,8 @@ protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::optional<AdapterController> m_adapter_controller;
+    // LoRA adapters are made resident for the requests of each step, so requests with different adapters share a batch
+    bool m_is_per_request_adapters = false;
     std::shared_ptr<Sampler> m_sampler;
 
     // current requests to process
@@ -33,6 +35,7 @@ protected:
     // for perf metrics
     float m_load_time_ms = 0.0f;
     size_t m_batch_size = 0; // stored number of processed tokens on last step
+    size_t m_num_scheduled_tokens = 0; // number of tokens inferred by the model on last step, including prompt tokens
 
     // flag to enable validation mode for sampler
     bool m_is_validation_mode_enabled = false;
@@ -40,6 +43,9 @@ protected:
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
 
+    // identifies the model in prefix cache snapshots, computed only if prefix caching is enabled
+    uint64_t m_model_fingerprint = 0;
+
     // Pre-allocated per-layer storages for the per-token cache re-rotation deltas used in cache eviction case
     std::vector<ov::Tensor> m_rotation_deltas_stores;
 
@@ -137,6 +143,10 @@ public:
 
     void step() override;
 
+    void save_prefix_cache(const std::filesystem::path& path) override;
+
+    bool load_prefix_cache(const std::filesystem::path& path) override;
+
     /**
      * input_ids is a batch of input ids for generation, which can be either raw prompts or already encoded token ids,
      * depending on the pipeline configuration. prompt_ids is an optional batch of prompt ids, which represents the
@@ -0,0 +1,198 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include "openvino/op/constant.hpp"
+#include "continuous_batching/prefix_cache_snapshot.hpp"
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'O', 'V', 'G', 'P', 'C', 'S', 'N', 'P'};
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+// number of bytes of each constant taken into the model fingerprint
+constexpr size_t FINGERPRINT_CONSTANT_SAMPLE_SIZE = 64;
+
+class FNV1aHash {
+    uint64_t m_value = 14695981039346656037ull;
+public:
+    void update(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            m_value ^= bytes[i];
+            m_value *= 1099511628211ull;
+        }
+    }
+
+    void update(const std::string& str) {
+        uint64_t size = str.size();
+        update(&size, sizeof(size));
+        update(str.data(), str.size());
+    }
+
+    uint64_t value() const {
+        return m_value;
+    }
+};
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::ifstream& file) {
+    T value{};
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    OPENVINO_ASSERT(file.good(), "Prefix cache snapshot is truncated");
+    return value;
+}
+
+void write_string(std::ofstream& file, const std::string& str) {
+    write_value<uint64_t>(file, str.size());
+    file.write(str.data(), str.size());
+}
+
+std::string read_string(std::ifstream& file) {
+    uint64_t size = read_value<uint64_t>(file);
+    // element type names are short, a larger value means a corrupted file
+    OPENVINO_ASSERT(size <= 64, "Prefix cache snapshot is corrupted");
+    std::string str(size, '\0');
+    file.read(str.data(), size);
+    OPENVINO_ASSERT(file.good(), "Prefix cache snapshot is truncated");
+    return str;
+}
+
+void write_layer_descriptions(std::ofstream& file, const std::vector<ov::element::Type>& precisions, const std::vector<ov::Shape>& shapes) {
+    write_value<uint64_t>(file, precisions.size());
+    for (size_t layer_idx = 0; layer_idx < precisions.size(); layer_idx++) {
+        write_string(file, precisions[layer_idx].get_type_name());
+        write_value<uint64_t>(file, shapes[layer_idx].size());
+        for (size_t dim : shapes[layer_idx]) {
+            write_value<uint64_t>(file, dim);
+        }
+    }
+}
+
+void read_layer_descriptions(std::ifstream& file, std::vector<ov::element::Type>& precisions, std::vector<ov::Shape>& shapes) {
+    uint64_t num_layers = read_value<uint64_t>(file);
+    OPENVINO_ASSERT(num_layers <= 4096, "Prefix cache snapshot is corrupted");
+    precisions.reserve(num_layers);
+    shapes.reserve(num_layers);
+    for (size_t layer_idx = 0; layer_idx < num_layers; layer_idx++) {
+        precisions.emplace_back(read_string(file));
+        uint64_t rank = read_value<uint64_t>(file);
+        OPENVINO_ASSERT(rank <= 8, "Prefix cache snapshot is corrupted");
+        ov::Shape shape(rank);
+        for (auto& dim : shape) {
+            dim = read_value<uint64_t>(file);
+        }
+        shapes.push_back(shape);
+    }
+}
+
+} // namespace
+
+namespace ov::genai {
+
+uint64_t compute_model_fingerprint(const std::shared_ptr<const ov::Model>& model) {
+    FNV1aHash hash;
+    for (const auto& op : model->get_ordered_ops()) {
+        hash.update(std::string(op->get_type_name()));
+        for (const auto& output : op->outputs()) {
+            hash.update(output.get_element_type().get_type_name());
+            hash.update(output.get_partial_shape().to_string());
+        }
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            uint64_t byte_size = constant->get_byte_size();
+            hash.update(&byte_size, sizeof(byte_size));
+            hash.update(constant->get_data_ptr(), std::min<size_t>(byte_size, FINGERPRINT_CONSTANT_SAMPLE_SIZE));
+        }
+    }
+    return hash.value();
+}
+
+uint64_t get_prefix_hash_function_probe() {
+    // prefix hashes are computed by std::hash<std::string_view>, see Sequence::_make_hash
+    const std::vector<int64_t> probe_content = {0, 1, 2, 3};
+    const char* data = reinterpret_cast<const char*>(probe_content.data());
+    return std::hash<std::string_view>{}(std::string_view(data, probe_content.size() * sizeof(probe_content[0])));
+}
+
+PrefixCacheSnapshotWriter::PrefixCacheSnapshotWriter(const std::filesystem::path& path, const PrefixCacheSnapshotHeader& header) :
+    m_path(path) {
+    if (m_path.has_parent_path()) {
+        std::filesystem::create_directories(m_path.parent_path());
+    }
+    m_file.open(m_path, std::ios::binary | std::ios::trunc);
+    OPENVINO_ASSERT(m_file.is_open(), "Cannot open prefix cache snapshot file for writing: ", m_path);
+
+    m_file.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    write_value<uint32_t>(m_file, SNAPSHOT_VERSION);
+    write_value<uint64_t>(m_file, header.model_fingerprint);
+    write_value<uint64_t>(m_file, header.block_size);
+    write_value<uint64_t>(m_file, header.hash_function_probe);
+    write_layer_descriptions(m_file, header.key_precisions, header.key_shapes);
+    write_layer_descriptions(m_file, header.value_precisions, header.value_shapes);
+    // the number of blocks is known only at finalize()
+    m_num_blocks_pos = m_file.tellp();
+    write_value<uint64_t>(m_file, 0);
+}
+
+void PrefixCacheSnapshotWriter::write_block(size_t hash, const HostKVCacheBlock& block) {
+    write_value<uint64_t>(m_file, hash);
+    for (const auto& tensor : block.key_blocks) {
+        m_file.write(static_cast<const char*>(tensor.data()), tensor.get_byte_size());
+    }
+    for (const auto& tensor : block.value_blocks) {
+        m_file.write(static_cast<const char*>(tensor.data()), tensor.get_byte_size());
+    }
+    ++m_num_blocks;
+}
+
+void PrefixCacheSnapshotWriter::finalize() {
+    m_file.seekp(m_num_blocks_pos);
+    write_value<uint64_t>(m_file, m_num_blocks);
+    m_file.close();
+    OPENVINO_ASSERT(m_file.good(), "Failed to write prefix cache snapshot: ", m_path);
+}
+
+PrefixCacheSnapshotReader::PrefixCacheSnapshotReader(const std::filesystem::path& path) {
+    m_file.open(path, std::ios::binary);
+    OPENVINO_ASSERT(m_file.is_open(), "Cannot open prefix cache snapshot file: ", path);
+
+    char magic[sizeof(SNAPSHOT_MAGIC)] = {};
+    m_file.read(magic, sizeof(magic));
+    OPENVINO_ASSERT(m_file.good() && std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0, "File is not a prefix cache snapshot: ", path);
+    uint32_t version = read_value<uint32_t>(m_file);
+    OPENVINO_ASSERT(version == SNAPSHOT_VERSION, "Unsupported prefix cache snapshot version ", version, ", expected ", SNAPSHOT_VERSION);
+
+    m_header.model_fingerprint = read_value<uint64_t>(m_file);
+    m_header.block_size = read_value<uint64_t>(m_file);
+    m_header.hash_function_probe = read_value<uint64_t>(m_file);
+    read_layer_descriptions(m_file, m_header.key_precisions, m_header.key_shapes);
+    read_layer_descriptions(m_file, m_header.value_precisions, m_header.value_shapes);
+    m_num_blocks = read_value<uint64_t>(m_file);
+}
+
+size_t PrefixCacheSnapshotReader::read_blocks(HostKVCacheStore& host_cache_store) {
+    size_t num_read_blocks = 0;
+    for (uint64_t block_idx = 0; block_idx < m_num_blocks; block_idx++) {
+        uint64_t hash = read_value<uint64_t>(m_file);
+        HostKVCacheBlock block = host_cache_store.allocate_block();
+        for (auto& tensor : block.key_blocks) {
+            m_file.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+        }
+        for (auto& tensor : block.value_blocks) {
+            m_file.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+        }
+        OPENVINO_ASSERT(m_file.good(), "Prefix cache snapshot is truncated");
+        host_cache_store.put(hash, std::move(block));
+        ++num_read_blocks;
+    }
+    return num_read_blocks;
+}
+
+}
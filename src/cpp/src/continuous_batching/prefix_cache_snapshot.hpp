@@ -0,0 +1,110 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+
+#include "openvino/core/model.hpp"
+#include "continuous_batching/host_cache_store.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Describes what a prefix cache snapshot is valid for. A snapshot can only be loaded into a pipeline
+ * with an identical description.
+ */
+struct PrefixCacheSnapshotHeader {
+    // see compute_model_fingerprint
+    uint64_t model_fingerprint = 0;
+    // KV cache block size in tokens
+    uint64_t block_size = 0;
+    // probe of the hash function used for the prefix hashes, which is implementation-defined
+    uint64_t hash_function_probe = 0;
+    std::vector<ov::element::Type> key_precisions, value_precisions;
+    // shapes of a single block, one for each decoder layer
+    std::vector<ov::Shape> key_shapes, value_shapes;
+
+    bool operator==(const PrefixCacheSnapshotHeader& other) const {
+        return model_fingerprint == other.model_fingerprint && block_size == other.block_size &&
+               hash_function_probe == other.hash_function_probe &&
+               key_precisions == other.key_precisions && value_precisions == other.value_precisions &&
+               key_shapes == other.key_shapes && value_shapes == other.value_shapes;
+    }
+
+    bool operator!=(const PrefixCacheSnapshotHeader& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Computes a cheap fingerprint of a model from its topology, output shapes and a small sample of each constant's data.
+ * @param model The model to compute the fingerprint for.
+ * @return The fingerprint value.
+ */
+uint64_t compute_model_fingerprint(const std::shared_ptr<const ov::Model>& model);
+
+/**
+ * @return The probe value for `PrefixCacheSnapshotHeader::hash_function_probe` in the current build.
+ */
+uint64_t get_prefix_hash_function_probe();
+
+/**
+ * @brief Writes the hashed KV cache blocks of the prefix cache into a versioned snapshot file.
+ */
+class PrefixCacheSnapshotWriter {
+    std::ofstream m_file;
+    std::filesystem::path m_path;
+    std::streampos m_num_blocks_pos;
+    uint64_t m_num_blocks = 0;
+public:
+    PrefixCacheSnapshotWriter(const std::filesystem::path& path, const PrefixCacheSnapshotHeader& header);
+
+    /**
+     * Appends the contents of a block to the snapshot.
+     * @param hash The prefix hash of the block.
+     * @param block The block contents in the layout described by the snapshot header.
+     */
+    void write_block(size_t hash, const HostKVCacheBlock& block);
+
+    /**
+     * Completes the snapshot file. Must be called after all blocks have been written.
+     */
+    void finalize();
+};
+
+/**
+ * @brief Reads a snapshot written by PrefixCacheSnapshotWriter.
+ */
+class PrefixCacheSnapshotReader {
+    std::ifstream m_file;
+    PrefixCacheSnapshotHeader m_header;
+    uint64_t m_num_blocks = 0;
+public:
+    /**
+     * Opens the snapshot and reads its header.
+     * @param path Path to the snapshot file.
+     * Throws if the file is not a prefix cache snapshot or has an unsupported version.
+     */
+    explicit PrefixCacheSnapshotReader(const std::filesystem::path& path);
+
+    const PrefixCacheSnapshotHeader& get_header() const {
+        return m_header;
+    }
+
+    uint64_t get_num_blocks() const {
+        return m_num_blocks;
+    }
+
+    /**
+     * Reads all blocks of the snapshot into a host store.
+     * @param host_cache_store The store to put the blocks to. Must have the layout described by the snapshot header.
+     * @return Number of blocks read.
+     */
+    size_t read_blocks(HostKVCacheStore& host_cache_store);
+};
+
+}
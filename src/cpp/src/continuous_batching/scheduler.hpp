@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdlib>
 #include <vector>
 
@@ -16,6 +17,9 @@
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/prefix_cache_snapshot.hpp"
+#include "continuous_batching/admission_policy.hpp"
+#include "continuous_batching/swap_space.hpp"
 
 namespace ov::genai {
 class Scheduler {
@@ -32,6 +36,20 @@ class Scheduler {
     const float m_cache_growth_num_tokens = 256; // Number of tokens by which KV-cache is increased
 
     std::shared_ptr<CacheManager> m_cache_manager;
+    // second tier of the prefix cache, nullptr if disabled
+    std::shared_ptr<HostKVCacheStore> m_host_cache_store;
+    std::unique_ptr<IAdmissionPolicy> m_admission_policy;
+
+    // host pool for swap-based preemption, nullptr if disabled
+    std::unique_ptr<KVCacheSwapSpace> m_swap_space;
+    PreemptionCostModel m_preemption_cost_model;
+    // copies of a logical block of a sequence between the device KV cache and the swap space
+    struct SwapTransfer {
+        uint64_t seq_id;
+        size_t logical_block_idx;
+        std::vector<size_t> block_indices;
+    };
+    std::vector<SwapTransfer> m_pending_swap_outs, m_pending_swap_ins;
 
     size_t m_snapkv_window_size = 1;
 public:
@@ -76,9 +94,15 @@ public:
         m_snapkv_window_size(snapkv_window_size) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        _initialize_host_cache_store();
+        _initialize_admission_policy();
+        _initialize_swap_space();
     }
 
     void release() {
+        m_swap_space.reset();
+        m_admission_policy.reset();
+        m_host_cache_store.reset();
         m_cache_manager.reset();
         m_block_manager.reset();
     }
@@ -88,6 +112,7 @@ public:
         // map of src -> dst blocks copies, which need to be performed by CacheManager
         std::map<size_t, std::list<size_t>> block_copy_map;
 
+        _release_dropped_swapped_out_sequences(sequence_groups);
         // free some blocks taken by non-confirmed candidates in SD / prompt look-up
         clean_empty_blocks(sequence_groups);
 
@@ -95,6 +120,11 @@ public:
             _initialize_cache(sequence_groups);
         }
 
+        // defines the order in which waiting prompts are admitted within the current step
+        m_admission_policy->order(sequence_groups);
+        // priority classes take precedence over the admission order, deadlines reorder waiting groups only
+        _order_by_priority(sequence_groups);
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -115,6 +145,12 @@ public:
 
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
         _clear_waiting_sequences(sequence_groups);
+
+        // blocks freed by swapping out may be overwritten by any of the following copies
+        _apply_swap_outs();
+        // must precede copy_blocks, since the blocks offloaded to host may be the destinations of the copies
+        _apply_host_transfers();
+        _apply_swap_ins();
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
         scheduler_output.m_cache_size_in_bytes = m_block_manager->get_total_number_of_kv_blocks() * m_cache_manager->get_block_size_in_bytes();
 
@@ -131,8 +167,21 @@ public:
      * when candidates are not confirmed by main model and we need to free blocks, taken by these candidates
      */
     void clean_empty_blocks(std::vector<SequenceGroup::Ptr>& seq_groups) {
-        for (const auto& seq_group : seq_groups)
+        for (const auto& seq_group : seq_groups) {
+            // swapped out sequences have no physical blocks
+            if (_is_swapped_out(seq_group))
+                continue;
             m_block_manager->free_empty_physical_blocks(seq_group);
+        }
+    }
+
+    /**
+     * Registers the duration of an inference, so that the costs of recompute and swap preemption can be compared.
+     * @param num_scheduled_tokens Total number of tokens scheduled for the inference.
+     * @param duration Duration of the inference.
+     */
+    void register_inference(size_t num_scheduled_tokens, std::chrono::steady_clock::duration duration) {
+        m_preemption_cost_model.register_inference(num_scheduled_tokens, duration);
     }
 
     const std::vector<BlocksPerLayer>& get_block_tables(const Sequence& seq) const {
@@ -177,6 +226,60 @@ public:
         m_block_manager->clear();
     }
 
+    /**
+     * Writes all hashed blocks of the prefix cache, both from the device KV cache and from the host cache store,
+     * into a snapshot file. Must not be called while sequences are being scheduled.
+     * @param path Path to the snapshot file.
+     * @param model_fingerprint Fingerprint of the model the KV cache was computed by.
+     * @return Number of blocks written.
+     */
+    size_t save_prefix_cache(const std::filesystem::path& path, uint64_t model_fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix cache snapshot requires prefix caching to be enabled");
+        _apply_host_transfers();
+
+        PrefixCacheSnapshotWriter writer(path, _get_prefix_cache_snapshot_header(model_fingerprint));
+        std::set<size_t> written_hashes;
+        auto hashed_blocks = m_block_manager->get_hashed_blocks();
+        if (!hashed_blocks.empty()) {
+            HostKVCacheBlock host_block = m_cache_manager->allocate_host_block();
+            for (const auto& [hash, block_indices] : hashed_blocks) {
+                m_cache_manager->copy_block_to_host(block_indices, host_block);
+                writer.write_block(hash, host_block);
+                written_hashes.insert(hash);
+            }
+        }
+        if (m_host_cache_store) {
+            m_host_cache_store->for_each_block([&writer, &written_hashes](size_t hash, const HostKVCacheBlock& block) {
+                if (written_hashes.insert(hash).second) {
+                    writer.write_block(hash, block);
+                }
+            });
+        }
+        writer.finalize();
+        return written_hashes.size();
+    }
+
+    /**
+     * Loads the blocks of a prefix cache snapshot into the host cache store, from where they are restored on
+     * prefix hash hits. Creates a host cache store large enough for the snapshot if offloading is not configured.
+     * @param path Path to the snapshot file.
+     * @param model_fingerprint Fingerprint of the current model.
+     * @return Whether the snapshot was loaded, i.e. whether it matches the current model and KV cache layout.
+     */
+    bool load_prefix_cache(const std::filesystem::path& path, uint64_t model_fingerprint) {
+        OPENVINO_ASSERT(m_config.enable_prefix_caching, "Prefix cache snapshot requires prefix caching to be enabled");
+        PrefixCacheSnapshotReader reader(path);
+        if (reader.get_header() != _get_prefix_cache_snapshot_header(model_fingerprint)) {
+            return false;
+        }
+        if (!m_host_cache_store) {
+            m_host_cache_store = m_cache_manager->create_host_cache_store(reader.get_num_blocks());
+            m_block_manager->set_host_cache_store(m_host_cache_store);
+        }
+        reader.read_blocks(*m_host_cache_store);
+        return true;
+    }
+
 private:
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
@@ -197,6 +300,9 @@ private:
         bool was_evicted_from = (sequence_group->get_num_evicted_tokens() != 0);
 
         if (num_blocks_occupied_by_sequence <= blocks_needed || !m_can_use_partial_preemption || was_evicted_from) {
+            if (!was_evicted_from && _try_swap_out(sequence_group)) {
+                return m_block_manager->num_free_blocks() > prev_blocks_count;
+            }
             auto sequences = sequence_group->get_not_finished_sequences();
             for (size_t s = 0; s < sequences.size(); ++s) {
                 auto seq_id = sequences[s]->get_id();
@@ -242,18 +348,74 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
-    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
-        for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
-            size_t group_idx = num_groups - seq_group_id - 1;
-            SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
-            if (sequence_group->get_num_processed_tokens() > 0) {
-                // we are here, because current sequence group has some reserved KV blocks in block manager
-                // which can be freed
-                return group_idx;
+    /**
+     * Stably sorts the sequence groups, so that groups of higher priority classes go first. Since groups are scheduled
+     * in this order and preemption victims are taken from the last priority class, this also makes groups of lower
+     * priority to be preempted first. Within a priority class, only the groups which have not been admitted yet are reordered among
+     * their positions, so that the ones closer to their time to first token deadlines go first. Admitted groups keep
+     * the order defined by the admission policy, so that they do not preempt each other as their slacks change.
+     * With default generation configs the order is kept.
+     */
+    static void _order_by_priority(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        std::stable_sort(sequence_groups.begin(), sequence_groups.end(), [](const SequenceGroup::Ptr& lhs, const SequenceGroup::Ptr& rhs) {
+            return lhs->get_sampling_parameters().priority > rhs->get_sampling_parameters().priority;
+        });
+
+        using Duration = std::chrono::steady_clock::duration;
+        const auto now = std::chrono::steady_clock::now();
+        for (size_t class_begin = 0; class_begin < sequence_groups.size();) {
+            const size_t priority = sequence_groups[class_begin]->get_sampling_parameters().priority;
+            size_t class_end = class_begin;
+            std::vector<size_t> waiting_positions;
+            std::vector<std::pair<Duration, SequenceGroup::Ptr>> waiting_groups;
+            for (; class_end < sequence_groups.size() && sequence_groups[class_end]->get_sampling_parameters().priority == priority; ++class_end) {
+                const auto& sequence_group = sequence_groups[class_end];
+                if (!sequence_group->can_generate_tokens() && sequence_group->get_num_processed_tokens() == 0 && !sequence_group->has_finished()) {
+                    waiting_positions.push_back(class_end);
+                    waiting_groups.emplace_back(sequence_group->get_deadline_slack(now).value_or(Duration::max()), sequence_group);
+                }
+            }
+            std::stable_sort(waiting_groups.begin(), waiting_groups.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+            for (size_t i = 0; i < waiting_positions.size(); ++i) {
+                sequence_groups[waiting_positions[i]] = waiting_groups[i].second;
             }
+            class_begin = class_end;
         }
+    }
 
-        return std::numeric_limits<size_t>::max();
+    /**
+     * Returns the index of the group to preempt for the group at requester_id, one of the groups ordered after it which
+     * hold KV blocks. The victim is taken from the lowest priority class among them and, within the class, it is the
+     * group with the most deadline slack, groups without deadlines being preempted first. Of equal groups the last one
+     * is taken, so with default generation configs the last group holding KV blocks is preempted.
+     * std::numeric_limits<size_t>::max() if there is no such group.
+     */
+    size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t requester_id) const {
+        using Duration = std::chrono::steady_clock::duration;
+        const auto now = std::chrono::steady_clock::now();
+        size_t victim_id = std::numeric_limits<size_t>::max();
+        Duration victim_slack{};
+        // the groups are ordered by priority, so the lowest priority class is at the end
+        for (size_t group_idx = sequence_groups.size(); group_idx-- > requester_id + 1;) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[group_idx];
+            // only a group which has some reserved KV blocks in block manager can free them
+            if (sequence_group->get_num_processed_tokens() == 0 || _is_swapped_out(sequence_group)) {
+                continue;
+            }
+            if (victim_id != std::numeric_limits<size_t>::max() &&
+                sequence_group->get_sampling_parameters().priority > sequence_groups[victim_id]->get_sampling_parameters().priority) {
+                break;
+            }
+            const Duration slack = sequence_group->get_deadline_slack(now).value_or(Duration::max());
+            if (victim_id == std::numeric_limits<size_t>::max() || slack > victim_slack) {
+                victim_id = group_idx;
+                victim_slack = slack;
+            }
+        }
+
+        return victim_id;
     }
 
     void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups) {
@@ -262,10 +424,10 @@ private:
         // check whether current sequence requires a new slot / block
         while (!m_block_manager->can_append_slots(sequence_group)) {
             // let's run a sequence for eviction
-            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups);
+            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups, sequence_group_id);
 
-            if (evicted_sequence_group_id <= sequence_group_id) {
-                // we have a cycle when current group need to evict itself to be in a running state
+            if (evicted_sequence_group_id == std::numeric_limits<size_t>::max()) {
+                // only the groups ordered after the current one can be evicted, so that it never evicts itself
                 break;
             }
             size_t blocks_needed = m_block_manager->required_blocks_count(sequence_group);
@@ -290,6 +452,8 @@ private:
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
+                if (m_admission_policy->is_deferred(sequence_group))
+                    continue;
                 Sequence::Ptr sequence = (*sequence_group)[0];
                 uint64_t seq_id = sequence->get_id();
 
@@ -323,6 +487,7 @@ private:
                         m_block_manager->allocate(sequence, num_scheduled_blocks, sequence_group->get_prompt_len());
                     // and schedule tokens
                     sequence_group->schedule_tokens(num_scheduled_tokens);
+                    m_admission_policy->on_prompt_scheduled(sequence_group);
 
                     // add information to scheduler_output
                     {
@@ -368,6 +533,9 @@ private:
             //         keep latencies for sequence groups of high priority
             if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
                 OPENVINO_ASSERT(!sequence_group->has_finished());
+                // a group preempted by swapping is resumed only when all its blocks can be copied back
+                if (_is_swapped_out(sequence_group) && !_try_swap_in(sequence_group))
+                    continue;
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 OPENVINO_ASSERT(num_running_seqs);
                 size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
@@ -465,6 +633,8 @@ private:
                 // here we also assume that sequence must be scheduler in a single shot and has no already generated context
                 if (!m_config.enable_prefix_caching)
                     OPENVINO_ASSERT(sequence_group->get_context_len() == 0);
+                if (m_admission_policy->is_deferred(sequence_group))
+                    continue;
                 size_t num_available_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t sequence_len = sequence_group->get_num_available_tokens_for_batching();
 
@@ -495,6 +665,7 @@ private:
                 {
                     // and schedule tokens
                     sequence_group->schedule_tokens(sequence_len);
+                    m_admission_policy->on_prompt_scheduled(sequence_group);
 
                     // allocate KV blocks
                     m_block_manager->append_slots(sequence_group);
@@ -531,6 +702,200 @@ private:
         }
     }
 
+    void _apply_host_transfers() {
+        if (!m_host_cache_store) {
+            return;
+        }
+        static ManualTimer host_transfer_timer("host cache transfer");
+        host_transfer_timer.start();
+        auto host_transfers = m_block_manager->pull_host_transfers();
+        m_cache_manager->copy_blocks_between_host(host_transfers, *m_host_cache_store);
+        host_transfer_timer.end();
+    }
+
+    PrefixCacheSnapshotHeader _get_prefix_cache_snapshot_header(uint64_t model_fingerprint) const {
+        PrefixCacheSnapshotHeader header;
+        header.model_fingerprint = model_fingerprint;
+        header.block_size = m_block_manager->get_block_size();
+        header.hash_function_probe = get_prefix_hash_function_probe();
+        header.key_precisions = m_cache_manager->get_key_cache_precisions();
+        header.value_precisions = m_cache_manager->get_value_cache_precisions();
+        header.key_shapes = m_cache_manager->get_key_block_shapes();
+        header.value_shapes = m_cache_manager->get_value_block_shapes();
+        return header;
+    }
+
+    void _initialize_host_cache_store() {
+        if (!m_config.enable_prefix_caching || m_config.prefix_cache_offload_size + m_config.prefix_cache_offload_dir_size == 0) {
+            return;
+        }
+        const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
+        OPENVINO_ASSERT(block_size_in_bytes > 0, "Internal error: KV cache block size in bytes is unknown");
+        const size_t bytes_in_gb = 1024 * 1024 * 1024;
+        size_t max_ram_blocks = m_config.prefix_cache_offload_size * bytes_in_gb / block_size_in_bytes;
+        size_t max_disk_blocks = 0;
+        std::filesystem::path spill_dir;
+        if (!m_config.prefix_cache_offload_dir.empty()) {
+            spill_dir = m_config.prefix_cache_offload_dir;
+            max_disk_blocks = m_config.prefix_cache_offload_dir_size * bytes_in_gb / block_size_in_bytes;
+        }
+        if (max_ram_blocks + max_disk_blocks == 0) {
+            return;
+        }
+        m_host_cache_store = m_cache_manager->create_host_cache_store(max_ram_blocks, spill_dir, max_disk_blocks);
+        m_block_manager->set_host_cache_store(m_host_cache_store);
+    }
+
+    void _initialize_admission_policy() {
+        if (m_config.enable_prefix_caching && m_config.admission_policy == AdmissionPolicy::CACHE_AWARE) {
+            m_admission_policy = std::make_unique<CacheAwareAdmissionPolicy>(m_block_manager, m_config.admission_max_wait_steps);
+        } else {
+            m_admission_policy = std::make_unique<FCFSAdmissionPolicy>();
+        }
+    }
+
+    void _initialize_swap_space() {
+        if (m_config.swap_space == 0) {
+            return;
+        }
+        const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
+        OPENVINO_ASSERT(block_size_in_bytes > 0, "Internal error: KV cache block size in bytes is unknown");
+        const size_t bytes_in_gb = 1024 * 1024 * 1024;
+        size_t capacity_in_blocks = m_config.swap_space * bytes_in_gb / block_size_in_bytes;
+        auto cache_manager = m_cache_manager;
+        m_swap_space = std::make_unique<KVCacheSwapSpace>(capacity_in_blocks, [cache_manager] {
+            return cache_manager->allocate_host_block();
+        });
+    }
+
+    bool _is_swapped_out(const SequenceGroup::Ptr& sequence_group) const {
+        if (!m_swap_space) {
+            return false;
+        }
+        auto sequences = sequence_group->get_not_finished_sequences();
+        return sequences.size() == 1 && m_swap_space->is_swapped_out(sequences[0]->get_id());
+    }
+
+    /**
+     * Preempts a sequence group by copying the contents of its KV cache blocks to the swap space and freeing the blocks,
+     * if it is expected to be cheaper than recomputing the KV cache of the group later.
+     * Only groups in the generation phase with a single sequence are swapped, since the blocks of beam search groups
+     * are shared between sequences.
+     * @param sequence_group The sequence group to be preempted.
+     * @return Whether the group has been swapped out.
+     */
+    bool _try_swap_out(const SequenceGroup::Ptr& sequence_group) {
+        if (!m_swap_space || !sequence_group->can_generate_tokens()) {
+            return false;
+        }
+        auto sequences = sequence_group->get_not_finished_sequences();
+        if (sequences.size() != 1) {
+            return false;
+        }
+        uint64_t seq_id = sequences[0]->get_id();
+        if (!m_block_manager->has_block_table(seq_id)) {
+            return false;
+        }
+        const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+        size_t num_blocks = block_tables[0].size();
+        if (num_blocks == 0 || !m_swap_space->can_swap_out(num_blocks) ||
+            !m_preemption_cost_model.is_swap_cheaper(sequence_group->get_num_processed_tokens(), num_blocks)) {
+            return false;
+        }
+
+        m_swap_space->swap_out(seq_id, num_blocks);
+        for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            std::vector<size_t> block_indices;
+            block_indices.reserve(block_tables.size());
+            for (const auto& layer_blocks : block_tables) {
+                block_indices.push_back(layer_blocks[block_idx]->get_index());
+            }
+            m_pending_swap_outs.push_back({seq_id, block_idx, std::move(block_indices)});
+        }
+        m_block_manager->free_sequence(seq_id);
+        sequence_group->set_waiting();
+        return true;
+    }
+
+    /**
+     * Allocates KV cache blocks for a swapped out sequence group and schedules copying its contents back into them.
+     * @param sequence_group The swapped out sequence group.
+     * @return Whether the group has been swapped in.
+     */
+    bool _try_swap_in(const SequenceGroup::Ptr& sequence_group) {
+        Sequence::Ptr sequence = sequence_group->get_not_finished_sequences()[0];
+        uint64_t seq_id = sequence->get_id();
+        size_t num_blocks = m_swap_space->get_swapped_blocks(seq_id).size();
+        while (!m_block_manager->can_allocate_blocks(num_blocks)) {
+            if (!_try_increase_cache()) {
+                return false;
+            }
+        }
+        m_block_manager->allocate(sequence, num_blocks, sequence_group->get_prompt_len());
+        const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+        for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+            std::vector<size_t> block_indices;
+            block_indices.reserve(block_tables.size());
+            for (const auto& layer_blocks : block_tables) {
+                block_indices.push_back(layer_blocks[block_idx]->get_index());
+            }
+            m_pending_swap_ins.push_back({seq_id, block_idx, std::move(block_indices)});
+        }
+        return true;
+    }
+
+    void _apply_swap_outs() {
+        if (m_pending_swap_outs.empty()) {
+            return;
+        }
+        static ManualTimer swap_out_timer("swap out");
+        swap_out_timer.start();
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& transfer : m_pending_swap_outs) {
+            auto& host_blocks = m_swap_space->get_swapped_blocks(transfer.seq_id);
+            m_cache_manager->copy_block_to_host(transfer.block_indices, host_blocks[transfer.logical_block_idx]);
+        }
+        m_preemption_cost_model.register_block_copies(m_pending_swap_outs.size(), std::chrono::steady_clock::now() - start);
+        m_pending_swap_outs.clear();
+        swap_out_timer.end();
+    }
+
+    void _apply_swap_ins() {
+        if (m_pending_swap_ins.empty()) {
+            return;
+        }
+        static ManualTimer swap_in_timer("swap in");
+        swap_in_timer.start();
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& transfer : m_pending_swap_ins) {
+            auto& host_blocks = m_swap_space->get_swapped_blocks(transfer.seq_id);
+            m_cache_manager->copy_block_from_host(transfer.block_indices, host_blocks[transfer.logical_block_idx]);
+        }
+        m_preemption_cost_model.register_block_copies(m_pending_swap_ins.size(), std::chrono::steady_clock::now() - start);
+        for (const auto& transfer : m_pending_swap_ins) {
+            m_swap_space->release(transfer.seq_id);
+        }
+        m_pending_swap_ins.clear();
+        swap_in_timer.end();
+    }
+
+    void _release_dropped_swapped_out_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        if (!m_swap_space || m_swap_space->num_used_blocks() == 0) {
+            return;
+        }
+        std::set<uint64_t> live_seq_ids;
+        for (const auto& sequence_group : sequence_groups) {
+            for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+                live_seq_ids.insert(sequence->get_id());
+            }
+        }
+        for (uint64_t seq_id : m_swap_space->get_swapped_out_sequence_ids()) {
+            if (live_seq_ids.count(seq_id) == 0) {
+                m_swap_space->release(seq_id);
+            }
+        }
+    }
+
     void _initialize_cache(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t blocks_sum = 0;
         for (auto idx = 0; idx < sequence_groups.size(); idx++) {
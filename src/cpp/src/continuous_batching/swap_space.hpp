@@ -0,0 +1,192 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "continuous_batching/host_cache_store.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Host memory pool keeping the KV cache blocks of sequences preempted by swapping, so that they can be copied
+ * back into the device KV cache instead of being recomputed when the sequences are resumed.
+ * Host blocks are allocated lazily up to the pool capacity and are reused after the sequences are swapped back in.
+ */
+class KVCacheSwapSpace {
+    size_t m_capacity_in_blocks;
+    std::function<HostKVCacheBlock()> m_block_factory;
+
+    size_t m_num_used_blocks = 0;
+    std::vector<HostKVCacheBlock> m_free_blocks;
+    // sequence id -> contents of its logical blocks
+    std::unordered_map<uint64_t, std::vector<HostKVCacheBlock>> m_swapped_sequences;
+
+public:
+    /**
+     * Constructs the KVCacheSwapSpace.
+     * @param capacity_in_blocks Maximum number of KV cache blocks kept in the pool.
+     * @param block_factory Function allocating host tensors for a single KV cache block.
+     */
+    KVCacheSwapSpace(size_t capacity_in_blocks, std::function<HostKVCacheBlock()> block_factory) :
+        m_capacity_in_blocks(capacity_in_blocks),
+        m_block_factory(std::move(block_factory)) {}
+
+    /**
+     * @param num_blocks Number of KV cache blocks to be swapped out.
+     * @return Whether the pool has enough space for the blocks.
+     */
+    bool can_swap_out(size_t num_blocks) const {
+        return m_num_used_blocks + num_blocks <= m_capacity_in_blocks;
+    }
+
+    /**
+     * Reserves host blocks for the contents of a sequence which is being swapped out.
+     * @param seq_id Identifier of the sequence.
+     * @param num_blocks Number of logical blocks of the sequence.
+     * @return Host blocks to copy the contents of each logical block of the sequence to.
+     */
+    std::vector<HostKVCacheBlock>& swap_out(uint64_t seq_id, size_t num_blocks) {
+        OPENVINO_ASSERT(can_swap_out(num_blocks), "Not enough space in the KV cache swap space");
+        OPENVINO_ASSERT(!is_swapped_out(seq_id), "Sequence ", seq_id, " is already swapped out");
+        auto& blocks = m_swapped_sequences[seq_id];
+        blocks.reserve(num_blocks);
+        for (size_t i = 0; i < num_blocks; ++i) {
+            if (m_free_blocks.empty()) {
+                blocks.push_back(m_block_factory());
+            } else {
+                blocks.push_back(std::move(m_free_blocks.back()));
+                m_free_blocks.pop_back();
+            }
+        }
+        m_num_used_blocks += num_blocks;
+        return blocks;
+    }
+
+    bool is_swapped_out(uint64_t seq_id) const {
+        return m_swapped_sequences.count(seq_id) > 0;
+    }
+
+    /**
+     * @param seq_id Identifier of a swapped out sequence.
+     * @return Host blocks with the contents of each logical block of the sequence.
+     */
+    std::vector<HostKVCacheBlock>& get_swapped_blocks(uint64_t seq_id) {
+        auto it = m_swapped_sequences.find(seq_id);
+        OPENVINO_ASSERT(it != m_swapped_sequences.end(), "Sequence ", seq_id, " is not swapped out");
+        return it->second;
+    }
+
+    /**
+     * Returns the host blocks of a sequence to the pool, either after they have been copied back into the device
+     * KV cache, or when the sequence is dropped.
+     * @param seq_id Identifier of a swapped out sequence.
+     */
+    void release(uint64_t seq_id) {
+        auto it = m_swapped_sequences.find(seq_id);
+        if (it == m_swapped_sequences.end()) {
+            return;
+        }
+        m_num_used_blocks -= it->second.size();
+        for (auto& block : it->second) {
+            m_free_blocks.push_back(std::move(block));
+        }
+        m_swapped_sequences.erase(it);
+    }
+
+    /**
+     * @return Identifiers of all currently swapped out sequences.
+     */
+    std::vector<uint64_t> get_swapped_out_sequence_ids() const {
+        std::vector<uint64_t> seq_ids;
+        seq_ids.reserve(m_swapped_sequences.size());
+        for (const auto& [seq_id, blocks] : m_swapped_sequences) {
+            seq_ids.push_back(seq_id);
+        }
+        return seq_ids;
+    }
+
+    size_t num_used_blocks() const {
+        return m_num_used_blocks;
+    }
+};
+
+/**
+ * @brief Estimates whether preempting a sequence by swapping its KV cache blocks out to host memory and back is cheaper
+ * than recomputing its KV cache. The costs are learned from the measured durations of inferences and of block copies:
+ * inference duration is fitted as a linear function of the number of scheduled tokens, whose slope gives the cost of
+ * recomputing a token. Measurements decay exponentially, so that the estimate follows changes of the workload.
+ */
+class PreemptionCostModel {
+    static constexpr double DECAY = 0.98;
+
+    // exponentially decayed sums for the least squares fit of inference duration = a + b * num_tokens
+    double m_weight = 0.0, m_sum_tokens = 0.0, m_sum_tokens_sq = 0.0, m_sum_seconds = 0.0, m_sum_tokens_seconds = 0.0;
+    // exponentially decayed sums of copied blocks and copy durations
+    double m_copied_blocks = 0.0, m_copy_seconds = 0.0;
+
+public:
+    /**
+     * @param num_tokens Number of tokens processed by an inference.
+     * @param duration Duration of the inference.
+     */
+    void register_inference(size_t num_tokens, std::chrono::steady_clock::duration duration) {
+        double seconds = std::chrono::duration<double>(duration).count();
+        double tokens = static_cast<double>(num_tokens);
+        m_weight = m_weight * DECAY + 1.0;
+        m_sum_tokens = m_sum_tokens * DECAY + tokens;
+        m_sum_tokens_sq = m_sum_tokens_sq * DECAY + tokens * tokens;
+        m_sum_seconds = m_sum_seconds * DECAY + seconds;
+        m_sum_tokens_seconds = m_sum_tokens_seconds * DECAY + tokens * seconds;
+    }
+
+    /**
+     * @param num_blocks Number of KV cache blocks copied between the device and the host.
+     * @param duration Duration of the copies.
+     */
+    void register_block_copies(size_t num_blocks, std::chrono::steady_clock::duration duration) {
+        m_copied_blocks = m_copied_blocks * DECAY + static_cast<double>(num_blocks);
+        m_copy_seconds = m_copy_seconds * DECAY + std::chrono::duration<double>(duration).count();
+    }
+
+    /**
+     * @return Estimated seconds to recompute a single token, 0 if not enough measurements have been made.
+     */
+    double get_seconds_per_token() const {
+        double variance = m_weight * m_sum_tokens_sq - m_sum_tokens * m_sum_tokens;
+        // inferences of the same size do not allow to separate the per-token cost from the fixed cost
+        if (m_weight < 2.0 || variance <= 1e-9 * m_weight * m_sum_tokens_sq) {
+            return 0.0;
+        }
+        return std::max(0.0, (m_weight * m_sum_tokens_seconds - m_sum_tokens * m_sum_seconds) / variance);
+    }
+
+    /**
+     * @return Estimated seconds to copy a single KV cache block between the device and the host,
+     * 0 if no copies have been measured.
+     */
+    double get_seconds_per_block_copy() const {
+        return m_copied_blocks > 0.0 ? m_copy_seconds / m_copied_blocks : 0.0;
+    }
+
+    /**
+     * @param num_tokens Number of tokens to be recomputed if the sequence is preempted by recomputation.
+     * @param num_blocks Number of KV cache blocks to be swapped out and back in if the sequence is preempted by swapping.
+     * @return Whether swapping is expected to be cheaper. Swapping is preferred until both costs have been measured.
+     */
+    bool is_swap_cheaper(size_t num_tokens, size_t num_blocks) const {
+        double seconds_per_token = get_seconds_per_token(), seconds_per_block_copy = get_seconds_per_block_copy();
+        if (seconds_per_token == 0.0 || seconds_per_block_copy == 0.0) {
+            return true;
+        }
+        return 2.0 * num_blocks * seconds_per_block_copy < num_tokens * seconds_per_token;
+    }
+};
+
+}
@@ -41,22 +41,9 @@ std::unordered_map<uint64_t, GenerationOutput> GenerationHandleImpl::read() {
     return m_generation_stream->read();
 }
 
-void add_partial_result(std::unordered_map<uint64_t, GenerationOutput>& partial_results, std::unordered_map<uint64_t, GenerationOutput>& iteration_results) {
-    for (auto& iteration_result: iteration_results) {
-        auto partial_result_iter = partial_results.find(iteration_result.first);
-        if (partial_result_iter == partial_results.end()) {
-            partial_results.emplace(iteration_result.first, iteration_result.second);
-        } else {
-            auto generated_len = iteration_result.second.generated_ids.size();
-            OPENVINO_ASSERT(generated_len == iteration_result.second.generated_log_probs.size());
-            for (size_t i = 0; i < generated_len; ++i) {
-                partial_result_iter->second.generated_ids.push_back(iteration_result.second.generated_ids[i]);
-                partial_result_iter->second.generated_log_probs.push_back(iteration_result.second.generated_log_probs[i]);
-            }
-            partial_result_iter->second.score = iteration_result.second.score;
-            partial_result_iter->second.finish_reason = iteration_result.second.finish_reason;
-        }
-    }
+bool GenerationHandleImpl::read_available(GenerationOutputs& outputs) {
+    OPENVINO_ASSERT(!is_stopped() && !is_cancelled(), "GenerationHandle cannot be used after it is stopped / cancelled.");
+    return m_generation_stream->read_available(outputs);
 }
 
 std::vector<GenerationOutput> GenerationHandleImpl::read_all() {
@@ -65,9 +52,8 @@ std::vector<GenerationOutput> GenerationHandleImpl::read_all() {
     std::unordered_map<uint64_t, GenerationOutput> partial_results;
     // We iterate until generation is running or there are tokens we haven't read yet
     while (get_status() == GenerationStatus::RUNNING || can_read()) {
-        // For unary case there's only one iteration and we get all results in a single read() call
-        std::unordered_map<uint64_t, GenerationOutput> iteration_results = read();
-        add_partial_result(partial_results, iteration_results);
+        // Results are appended directly to the partial ones, so no intermediate outputs are allocated per iteration
+        m_generation_stream->read_into(partial_results);
     }
 
     for (auto& partial_result : partial_results) {
@@ -4,15 +4,81 @@
 #pragma once
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <queue>
+#include <limits>
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_handle.hpp"
-#include "synchronized_queue.hpp"
+#include "spsc_ring_buffer.hpp"
 
 namespace ov::genai {
+/**
+ * @brief Channel of generation results from a pipeline to the handle of a request. Tokens streamed at each step are
+ * passed through a lock-free ring buffer without allocations, while complete outputs of several sequences, which are
+ * pushed once per request, go through a locked queue. Each queued output is placed after the tokens pushed before it,
+ * so the reader gets the results in the order of pushing.
+ * Pushes have to be made by one thread at a time and reads by one thread at a time.
+ */
 class GenerationStream {
+    // a token of the streamed sequence together with the state of the sequence after it
+    struct GeneratedToken {
+        int64_t id;
+        float log_prob;
+        float score;
+        GenerationFinishReason finish_reason;
+    };
+    // fits tokens of several steps in case the reader lags behind, tokens which do not fit are queued
+    static constexpr size_t TOKENS_CAPACITY = 64;
+
     std::mutex m_mutex;
     GenerationStatus m_status = GenerationStatus::RUNNING;
-    SynchronizedQueue<GenerationOutputs> m_output_queue;
+
+    SPSCRingBuffer<GeneratedToken> m_tokens{TOKENS_CAPACITY};
+    std::atomic<uint64_t> m_tokens_sequence_id{0};
+
+    std::mutex m_outputs_mutex;
+    std::condition_variable m_outputs_cv;
+    // queued outputs with the positions of the tokens they follow
+    std::queue<std::pair<size_t, GenerationOutputs>> m_outputs;
+    std::atomic<bool> m_is_reader_waiting{false};
+
+    static void _append(GenerationOutput& output, const GenerationOutput& new_output) {
+        output.generated_ids.insert(output.generated_ids.end(), new_output.generated_ids.begin(), new_output.generated_ids.end());
+        output.generated_log_probs.insert(output.generated_log_probs.end(), new_output.generated_log_probs.begin(), new_output.generated_log_probs.end());
+        output.score = new_output.score;
+        output.finish_reason = new_output.finish_reason;
+    }
+
+    // requires m_outputs_mutex to be locked
+    bool _can_read() const {
+        return !m_outputs.empty() || m_tokens.has_items();
+    }
+
+    // requires m_outputs_mutex to be locked
+    bool _read_available(GenerationOutputs& outputs) {
+        bool has_read = false;
+        while (true) {
+            const size_t tokens_end = m_outputs.empty() ? std::numeric_limits<size_t>::max() : m_outputs.front().first;
+            GenerationOutput* output = nullptr;
+            has_read |= m_tokens.consume(tokens_end, [&](const GeneratedToken& token) {
+                if (output == nullptr) {
+                    output = &outputs[m_tokens_sequence_id.load(std::memory_order_relaxed)];
+                }
+                output->generated_ids.push_back(token.id);
+                output->generated_log_probs.push_back(token.log_prob);
+                output->score = token.score;
+                output->finish_reason = token.finish_reason;
+            }) > 0;
+            if (m_outputs.empty() || m_outputs.front().first != m_tokens.get_consume_position()) {
+                return has_read;
+            }
+            for (const auto& [sequence_id, output] : m_outputs.front().second) {
+                _append(outputs[sequence_id], output);
+            }
+            m_outputs.pop();
+            has_read = true;
+        }
+    }
 
 public:
     using Ptr = std::shared_ptr<GenerationStream>;
@@ -25,15 +91,85 @@ public:
     }
 
     void push(GenerationOutputs outputs) {
-        m_output_queue.push(std::move(outputs));
+        {
+            std::lock_guard<std::mutex> lock(m_outputs_mutex);
+            m_outputs.emplace(m_tokens.get_push_position(), std::move(outputs));
+        }
+        m_outputs_cv.notify_one();
+    }
+
+    /**
+     * Pushes new tokens of a single streamed sequence without locking or allocating in the common case.
+     * @param sequence_id Grouped identifier of the sequence, the same for all pushes to the stream.
+     * @param token_ids New tokens.
+     * @param log_probs Log probabilities of the new tokens.
+     * @param num_tokens Number of the new tokens.
+     * @param score Score of the sequence after the new tokens.
+     * @param finish_reason Finish reason of the sequence after the new tokens.
+     */
+    void push_tokens(uint64_t sequence_id, const int64_t* token_ids, const float* log_probs, size_t num_tokens,
+                     float score, GenerationFinishReason finish_reason) {
+        m_tokens_sequence_id.store(sequence_id, std::memory_order_relaxed);
+        bool is_pushed = m_tokens.try_push(num_tokens, [&](size_t i) {
+            return GeneratedToken{token_ids[i], log_probs[i], score, finish_reason};
+        });
+        if (!is_pushed) {
+            GenerationOutput output;
+            output.generated_ids.assign(token_ids, token_ids + num_tokens);
+            output.generated_log_probs.assign(log_probs, log_probs + num_tokens);
+            output.score = score;
+            output.finish_reason = finish_reason;
+            push({{sequence_id, std::move(output)}});
+            return;
+        }
+        // a waiting reader sets the flag before checking for tokens, so either it sees the tokens or it is notified
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_is_reader_waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_outputs_mutex);
+            m_outputs_cv.notify_one();
+        }
     }
 
+    /**
+     * Waits for results and reads all of them.
+     */
     GenerationOutputs read() {
-        return m_output_queue.pull();
+        GenerationOutputs outputs;
+        read_into(outputs);
+        return outputs;
+    }
+
+    /**
+     * Waits for results and appends all of them to the outputs read before.
+     */
+    void read_into(GenerationOutputs& outputs) {
+        std::unique_lock<std::mutex> lock(m_outputs_mutex);
+        if (!_can_read()) {
+            m_is_reader_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_outputs_cv.wait(lock, [this] { return _can_read(); });
+            m_is_reader_waiting.store(false, std::memory_order_relaxed);
+        }
+        _read_available(outputs);
+    }
+
+    /**
+     * Reads the results pushed since the previous read without waiting. The ids and log probabilities of the sequences
+     * in the outputs are replaced by the new ones, so their storage is reused instead of being allocated again.
+     * @return false if there were no results to read.
+     */
+    bool read_available(GenerationOutputs& outputs) {
+        for (auto& [sequence_id, output] : outputs) {
+            output.generated_ids.clear();
+            output.generated_log_probs.clear();
+        }
+        std::lock_guard<std::mutex> lock(m_outputs_mutex);
+        return _read_available(outputs);
     }
 
     bool can_read() {
-        return !m_output_queue.empty();
+        std::lock_guard<std::mutex> lock(m_outputs_mutex);
+        return _can_read();
     }
 
     void set_generation_status(GenerationStatus status) {
@@ -3,11 +3,19 @@
 
 #include "gguf_utils/gguf.hpp"
 
+#ifndef _WIN32
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <numeric>
+#include <openvino/core/parallel.hpp>
 #include <optional>
 
 // https://github.com/antirez/gguf-tools/blob/af7d88d808a7608a33723fba067036202910acb3/gguflib.h#L102-L108
@@ -80,28 +88,25 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
-    std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor->type);
-    // If there's an equivalent type, we can simply copy.
-    if (equivalent_dtype.has_value()) {
-        auto shape = get_shape(*tensor);
-        ov::Tensor weights(equivalent_dtype.value(), shape);
+ov::Tensor allocate_tensor_data(const gguf_tensor& tensor) {
+    // Tensors without an equivalent type are converted to float16.
+    return ov::Tensor(gguf_type_to_dtype(tensor.type).value_or(ov::element::f16), get_shape(tensor));
+}
 
-        memcpy(weights.data(), tensor->weights_data, tensor->num_weights * equivalent_dtype.value().size());
-        return weights;
+void extract_tensor_data(gguf_tensor* tensor, ov::Tensor& weights) {
+    // If there's an equivalent type, we can simply copy.
+    if (gguf_type_to_dtype(tensor->type).has_value()) {
+        memcpy(weights.data(), tensor->weights_data, weights.get_byte_size());
+        return;
     }
     // Otherwise, we convert to float16.
     // TODO: Add other dequantization options.
     int16_t* data = gguf_tensor_to_f16(tensor);
     OPENVINO_ASSERT(data != nullptr, "[load_gguf] gguf_tensor_to_f16 failed");
 
-    auto shape = get_shape(*tensor);
     const size_t new_size = tensor->num_weights * sizeof(int16_t);
-    ov::Tensor weights(ov::element::f16, shape);
     memcpy(weights.data(), data, new_size);
     free(data);
-
-    return weights;
 }
 
 void set_value_from_gguf(gguf_ctx* ctx, uint32_t type, gguf_value* val, GGUFMetaData& value) {
@@ -263,9 +268,24 @@ std::unordered_map<std::string, GGUFMetaData> load_metadata(gguf_ctx* ctx) {
     return metadata;
 }
 
-void load_arrays(gguf_ctx* ctx,
-                 std::unordered_map<std::string, ov::Tensor>& array_map,
-                 std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
+bool is_quantized_type(uint32_t type) {
+    return type == GGUF_TYPE_Q4_0 || type == GGUF_TYPE_Q4_1 || type == GGUF_TYPE_Q8_0 || type == GGUF_TYPE_Q4_K ||
+           type == GGUF_TYPE_Q6_K;
+}
+
+// Tensor of a GGUF file with the tensors its data is extracted into.
+struct TensorConversion {
+    gguf_tensor tensor;
+    ov::Tensor weights;
+    GGUFQuantizedTensors quantized;
+};
+
+// Allocates the tensors of all the tensors of the file and adds them to the maps, the data is extracted later
+// by convert_arrays. The file must stay open until then.
+void allocate_arrays(gguf_ctx* ctx,
+                     std::unordered_map<std::string, ov::Tensor>& array_map,
+                     std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
+                     std::vector<TensorConversion>& conversions) {
     gguf_tensor tensor;
 
     auto check_insert = [](const auto& inserted) {
@@ -276,21 +296,62 @@ void load_arrays(gguf_ctx* ctx,
     };
 
     while (gguf_get_tensor(ctx, &tensor)) {
-        if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
-            tensor.type == GGUF_TYPE_Q4_K || tensor.type == GGUF_TYPE_Q6_K) {
-            gguf_load_quantized(array_map, qtype_map, tensor);
+        TensorConversion conversion{tensor};
+        if (is_quantized_type(tensor.type)) {
+            conversion.quantized = allocate_quantized_tensors(tensor);
+            insert_quantized_tensors(array_map, qtype_map, tensor, conversion.quantized);
         } else {
             std::string name(tensor.name, tensor.namelen);
-            ov::Tensor loaded_array = extract_tensor_data(&tensor);
-            check_insert(array_map.emplace(name, loaded_array));
+            conversion.weights = allocate_tensor_data(tensor);
+            check_insert(array_map.emplace(name, conversion.weights));
 
             constexpr std::string_view weight_suffix = ".weight";
             const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
             qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
         }
+        conversions.push_back(std::move(conversion));
     }
 }
 
+// Drops the pages of the file mapping which hold only the data of the tensor, so the converted tensors do not
+// double the resident memory. The pages are read from the file again if they are accessed later.
+void release_tensor_pages(const gguf_tensor& tensor) {
+#ifndef _WIN32
+    static const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t data_begin = reinterpret_cast<uintptr_t>(tensor.weights_data);
+    const uintptr_t begin = (data_begin + page_size - 1) / page_size * page_size;
+    const uintptr_t end = (data_begin + tensor.bsize) / page_size * page_size;
+    if (begin < end) {
+        // MADV_DONTNEED is only safe because the mapping is file-backed and the loader never writes to it, so the
+        // dropped pages are read back from the file unchanged. On an anonymous or a written private mapping the
+        // pages would read as zeros or as the original file content.
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+    }
+#endif
+}
+
+// Extracts the data of the tensors of all the files in parallel, the largest tensors first.
+void convert_arrays(std::vector<TensorConversion>& conversions) {
+    std::vector<size_t> order(conversions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return conversions[lhs].tensor.bsize > conversions[rhs].tensor.bsize;
+    });
+
+    std::atomic<size_t> next{0};
+    ov::parallel_nt(ov::parallel_get_max_threads(), [&](const int, const int) {
+        for (size_t i = next++; i < order.size(); i = next++) {
+            TensorConversion& conversion = conversions[order[i]];
+            if (is_quantized_type(conversion.tensor.type)) {
+                extract_quantized_data(conversion.tensor, conversion.quantized);
+            } else {
+                extract_tensor_data(&conversion.tensor, conversion.weights);
+            }
+            release_tensor_pages(conversion.tensor);
+        }
+    });
+}
+
 void check_file(std::string file) {
     bool exists;
     {
@@ -334,11 +395,11 @@ GGUFLoad get_gguf_data(const std::string& file) {
     std::string split_flag = "split.count";
     auto it = metadata.find(split_flag);
 
-    if (it == metadata.end())  // single GGUF file
-    {
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
-    } else  // multi GGUF files
+    // The files are mapped into memory by gguf_open, they stay open until the data of all the tensors is converted
+    std::vector<std::unique_ptr<gguf_ctx, decltype(&gguf_close)>> split_ctxs;
+    std::vector<TensorConversion> conversions;
+
+    if (it != metadata.end())  // multi GGUF files
     {
         auto total_num_tensor = std::get<ov::Tensor>(metadata.at(split_flag));
         int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
@@ -351,11 +412,13 @@ GGUFLoad get_gguf_data(const std::string& file) {
 
             auto metadata_tmp = load_metadata(ctx_i.get());
 
-            load_arrays(ctx_i.get(), arrays, qtype);
+            allocate_arrays(ctx_i.get(), arrays, qtype, conversions);
+            split_ctxs.push_back(std::move(ctx_i));
         }
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
     }
+    allocate_arrays(ctx.get(), arrays, qtype, conversions);
+    convert_arrays(conversions);
+    return {metadata, arrays, qtype};
 }
 
 float metadata_to_float(const std::unordered_map<std::string, GGUFMetaData>& metadata, const std::string& key) {
@@ -32,6 +32,25 @@ std::string format(std::string fmt, Args... args);
 
 ov::Shape get_shape(const gguf_tensor& tensor);
 
+// Tensors a quantized GGUF tensor is loaded as.
+struct GGUFQuantizedTensors {
+    ov::Tensor weights;
+    ov::Tensor scales;
+    ov::Tensor biases;
+};
+
+// Allocates the tensors a quantized GGUF tensor is loaded as, so its data can be extracted later.
+GGUFQuantizedTensors allocate_quantized_tensors(const gguf_tensor& tensor);
+
+// Extracts the data of a quantized GGUF tensor into the tensors allocated by allocate_quantized_tensors.
+void extract_quantized_data(const gguf_tensor& tensor, GGUFQuantizedTensors& tensors);
+
+// Adds the tensors of a quantized GGUF tensor and its quantization type to the maps.
+void insert_quantized_tensors(std::unordered_map<std::string, ov::Tensor>& a,
+                              std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
+                              const gguf_tensor& tensor,
+                              const GGUFQuantizedTensors& tensors);
+
 void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
                          std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
                          const gguf_tensor& tensor);
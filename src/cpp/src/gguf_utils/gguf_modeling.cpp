@@ -5,12 +5,17 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <iomanip>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <regex>
 #include <stdexcept>
 
 #include <openvino/openvino.hpp>
 #include "openvino/runtime/core.hpp"
 #include "openvino/opsets/opset13.hpp"
+#include "openvino/genai/version.hpp"
 
 #include "gguf_utils/building_blocks.hpp"
 #include "gguf_utils/gguf_modeling.hpp"
@@ -136,8 +141,141 @@ std::shared_ptr<ov::Model> create_language_model(
     return model;
 }
 
+// Returns all the files of a model split into "<name>-00001-of-0000N.gguf" files, or the file itself.
+std::vector<std::filesystem::path> get_gguf_files(const std::filesystem::path& model_path) {
+    static const std::regex split_name("(.*)-([0-9]{5})-of-([0-9]{5})\\.gguf");
+    std::smatch match;
+    const std::string file_name = model_path.filename().string();
+    if (!std::regex_match(file_name, match, split_name)) {
+        return {model_path};
+    }
+    std::vector<std::filesystem::path> files;
+    const int total_num = std::stoi(match[3].str());
+    for (int i = 1; i <= total_num; ++i) {
+        std::stringstream split_file_name;
+        split_file_name << match[1].str() << "-" << std::setw(5) << std::setfill('0') << i << "-of-" << match[3].str() << ".gguf";
+        files.push_back(model_path.parent_path() / split_file_name.str());
+    }
+    return files;
+}
+
+// Fingerprint of the GGUF files, of the properties passed to read_model and of the code building the model from them,
+// the built model is cached by it. The files are identified by their sizes, modification times and headers, which
+// hold the metadata and the layout of the tensors, so that the weights are not read. Every property except
+// ov::cache_dir is a part of the fingerprint, since the model read with other properties may differ.
+std::string get_gguf_fingerprint(const std::filesystem::path& model_path, const ov::AnyMap& properties) {
+    constexpr size_t header_size = 1 << 20;
+    uint64_t hash = 14695981039346656037ull;  // FNV-1a
+    auto update = [&hash](const char* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * 1099511628211ull;
+        }
+    };
+    auto update_value = [&update](const auto& value) {
+        update(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    auto update_string = [&update, &update_value](const std::string& value) {
+        update_value(value.size());
+        update(value.data(), value.size());
+    };
+
+    update_string(ov::genai::get_version().buildNumber);
+
+    // ov::AnyMap is ordered by the property names, so the same properties always give the same fingerprint
+    for (const auto& [name, value] : properties) {
+        if (name == ov::cache_dir.name()) {
+            continue;
+        }
+        update_string(name);
+        try {
+            update_string(value.as<std::string>());
+        } catch (const ov::Exception&) {
+            // a value which cannot be printed is identified by its type only
+            update_string(value.type_info().name());
+        }
+    }
+
+    std::vector<char> header(header_size);
+    for (const auto& file : get_gguf_files(model_path)) {
+        const uint64_t file_size = std::filesystem::file_size(file);
+        const int64_t mtime = std::filesystem::last_write_time(file).time_since_epoch().count();
+        update_value(file_size);
+        update_value(mtime);
+
+        std::ifstream stream(file, std::ios::binary);
+        OPENVINO_ASSERT(stream.is_open(), "Failed to open '", file.string(), "'");
+        stream.read(header.data(), header.size());
+        update(header.data(), static_cast<size_t>(stream.gcount()));
+    }
+
+    std::stringstream fingerprint;
+    fingerprint << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return fingerprint.str();
+}
+
+// Saves the model into the cache directory, writing it to a temporary directory first, so that other processes
+// never read a partially written model.
+void save_cached_model(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& cached_model_dir) {
+    std::stringstream tmp_name;
+    tmp_name << cached_model_dir.filename().string() << ".tmp." << std::hex
+             << std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::filesystem::path tmp_dir = cached_model_dir.parent_path() / tmp_name.str();
+    try {
+        std::filesystem::create_directories(tmp_dir);
+        // the weights are kept in their precision, so that the cached model is the same as the built one
+        ov::save_model(model, (tmp_dir / "openvino_model.xml").string(), false);
+        std::error_code ec;
+        std::filesystem::rename(tmp_dir, cached_model_dir, ec);
+        if (ec) {
+            // the model is cached by another process already
+            std::filesystem::remove_all(tmp_dir, ec);
+        }
+    } catch (const std::exception& e) {
+        std::error_code ec;
+        std::filesystem::remove_all(tmp_dir, ec);
+        ov::genai::utils::print_gguf_debug_info(std::string("Failed to cache the generated OpenVINO model: ") + e.what());
+    }
+}
+
 } // namespace
 
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const ov::AnyMap& properties) {
+    auto cache_dir_it = properties.find(ov::cache_dir.name());
+    const std::string cache_dir = cache_dir_it == properties.end() ? std::string{} : cache_dir_it->second.as<std::string>();
+    if (cache_dir.empty()) {
+        return create_from_gguf(model_path, enable_save_ov_model);
+    }
+
+    const std::filesystem::path cached_model_dir =
+        std::filesystem::path(cache_dir) / "gguf" / get_gguf_fingerprint(model_path, properties);
+    const std::filesystem::path cached_model_path = cached_model_dir / "openvino_model.xml";
+
+    std::shared_ptr<ov::Model> model;
+    if (std::filesystem::exists(cached_model_path)) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        model = ov::genai::utils::singleton_core().read_model(cached_model_path, {}, properties);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_time).count();
+        std::stringstream ss;
+        ss << "Read generated OpenVINO model from cache: " << cached_model_path.string() << ". Time: " << duration << "ms";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+
+        // the model saved next to the GGUF file by an earlier build is not serialized again
+        std::filesystem::path save_path = std::filesystem::path(model_path).parent_path() / "openvino_model.xml";
+        if (enable_save_ov_model && !std::filesystem::exists(save_path)) {
+            ov::genai::utils::save_openvino_model(model, save_path.string(), true);
+        }
+        return model;
+    }
+
+    model = create_from_gguf(model_path, enable_save_ov_model);
+    save_cached_model(model, cached_model_dir);
+    return model;
+}
+
 std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model) {
     auto start_time = std::chrono::high_resolution_clock::now();
     std::stringstream ss;
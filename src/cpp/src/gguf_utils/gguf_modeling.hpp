@@ -8,3 +8,10 @@
 #include "openvino/openvino.hpp"
 
 std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model);
+
+// Builds the model like create_from_gguf, caching it as IR in the "gguf" subdirectory of the ov::cache_dir
+// from properties, so that the next builds from the same files with the same properties only read the IR.
+// The cache is not used if ov::cache_dir is not set.
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const ov::AnyMap& properties);
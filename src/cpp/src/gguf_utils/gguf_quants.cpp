@@ -75,7 +75,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    for (int64_t i = 0; i < scales_arr.get_size(); i++) {
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
         scales[i] = ov::float16::from_bits(*(uint16_t*)block_data);
         biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
@@ -86,7 +86,7 @@ void extract_q8_0_data(const gguf_tensor& tensor,
             x ^= 1 << 7;
             weights[i * weights_per_block + j] = x;
         }
-    }
+    });
 }
 
 void unpack_256_4(const uint8_t* data, uint8_t* dst) {
@@ -169,7 +169,7 @@ void extract_q6_k_data(const gguf_tensor& tensor,
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     // std::string name(tensor.name, tensor.namelen);
-    for (int64_t i = 0; i < n_super_block; i++) {
+    ov::parallel_for(n_super_block, [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
 
         float scale_factor =
@@ -196,12 +196,10 @@ void extract_q6_k_data(const gguf_tensor& tensor,
             weights[i * 256 + j + 192] = (ql[64 + j] >> 4) | (((qh[32 + j] >> 4) & 3) << 4);
             weights[i * 256 + j + 224] = (ql[96 + j] >> 4) | (((qh[32 + j] >> 6) & 3) << 4);
         }
-    }
+    });
 }
 
-void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
-                         std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
-                         const gguf_tensor& tensor) {
+GGUFQuantizedTensors allocate_quantized_tensors(const gguf_tensor& tensor) {
     uint64_t weights_per_byte;
     if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q4_K) {
         weights_per_byte = 2;
@@ -230,28 +228,40 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
     auto weights_shape = shape;
     weights_shape.back() /= (weights_per_byte * 4);  // means u32 type can store 8 q4 or 4 q8
 
-    ov::Tensor weights(ov::element::u32, std::move(weights_shape));
+    GGUFQuantizedTensors tensors;
+    tensors.weights = ov::Tensor(ov::element::u32, std::move(weights_shape));
     // For scales and bias
     shape[shape.size() - 1] = shape[shape.size() - 1] / weights_per_block;
 
-    ov::Tensor scales(ov::element::f16, shape);
-    ov::Tensor biases(ov::element::f16, std::move(shape));
+    tensors.scales = ov::Tensor(ov::element::f16, shape);
+    tensors.biases = ov::Tensor(ov::element::f16, std::move(shape));
+    return tensors;
+}
+
+void extract_quantized_data(const gguf_tensor& tensor, GGUFQuantizedTensors& tensors) {
     if (tensor.type == GGUF_TYPE_Q4_0) {
-        extract_q4_0_data(tensor, weights, scales, biases);
+        extract_q4_0_data(tensor, tensors.weights, tensors.scales, tensors.biases);
     } else if (tensor.type == GGUF_TYPE_Q4_1) {
-        extract_q4_1_data(tensor, weights, scales, biases);
+        extract_q4_1_data(tensor, tensors.weights, tensors.scales, tensors.biases);
     } else if (tensor.type == GGUF_TYPE_Q8_0) {
-        extract_q8_0_data(tensor, weights, scales, biases);
+        extract_q8_0_data(tensor, tensors.weights, tensors.scales, tensors.biases);
     } else if (tensor.type == GGUF_TYPE_Q6_K) {
         // due to WA #2135, this case will not be used, extract_q6_k_data temporarily disabled.
-        extract_q6_k_data(tensor, weights, scales, biases);
+        extract_q6_k_data(tensor, tensors.weights, tensors.scales, tensors.biases);
     } else if (tensor.type == GGUF_TYPE_Q4_K) {
-        extract_q4_k_data(tensor, weights, scales, biases);
+        extract_q4_k_data(tensor, tensors.weights, tensors.scales, tensors.biases);
     } else {
         OPENVINO_ASSERT("Unsupported tensor type in 'gguf_load_quantized'");
     }
+}
 
-    a.emplace(name, std::move(weights));
+void insert_quantized_tensors(std::unordered_map<std::string, ov::Tensor>& a,
+                              std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
+                              const gguf_tensor& tensor,
+                              const GGUFQuantizedTensors& tensors) {
+    std::string name(tensor.name, tensor.namelen);
+
+    a.emplace(name, tensors.weights);
 
     auto check_insert = [](const auto& inserted) {
         OPENVINO_ASSERT(inserted.second,
@@ -262,8 +272,16 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
 
     constexpr std::string_view weight_suffix = ".weight";
     const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
-    check_insert(a.emplace(name_prefix + ".scales", std::move(scales)));
-    check_insert(a.emplace(name_prefix + ".biases", std::move(biases)));
+    check_insert(a.emplace(name_prefix + ".scales", tensors.scales));
+    check_insert(a.emplace(name_prefix + ".biases", tensors.biases));
 
     qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
 }
+
+void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
+                         std::unordered_map<std::string, gguf_tensor_type>& qtype_map,
+                         const gguf_tensor& tensor) {
+    GGUFQuantizedTensors tensors = allocate_quantized_tensors(tensor);
+    extract_quantized_data(tensor, tensors);
+    insert_quantized_tensors(a, qtype_map, tensor, tensors);
+}
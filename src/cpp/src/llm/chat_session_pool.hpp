@@ -0,0 +1,158 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <optional>
+
+#include "openvino/genai/chat_history.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Pool of suspended chat sessions of a stateful LLM pipeline. When a chat history which does not continue the
+ * current session is passed to the pipeline, the current session is saved to host memory and the session whose
+ * history is the longest prefix of the new one is restored, so that only the new part of the conversation has to be
+ * encoded instead of the whole history. Sessions are evicted in the least recently used order to fit the memory budget.
+ */
+class ChatSessionPool {
+public:
+    struct Session {
+        ChatHistory history;
+        // tokens contained in the saved KV cache
+        utils::KVCacheState kv_cache_state;
+        ov::Tensor attention_mask;
+        // model states except the LoRA adapter ones, which are shared by all sessions
+        std::vector<std::pair<std::string, ov::Tensor>> states;
+
+        size_t get_byte_size() const {
+            size_t byte_size = attention_mask.get_byte_size();
+            for (const auto& [name, state] : states) {
+                byte_size += state.get_byte_size();
+            }
+            return byte_size;
+        }
+    };
+
+private:
+    size_t m_max_byte_size;
+    size_t m_byte_size = 0;
+    // the most recently suspended session first
+    std::list<Session> m_sessions;
+
+    static ov::Tensor _copy_to_host(const ov::Tensor& tensor) {
+        ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(copy);
+        return copy;
+    }
+
+    static bool _is_prefix(const ChatHistory& prefix, const ChatHistory& history) {
+        if (prefix.size() > history.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < prefix.size(); ++i) {
+            if (prefix[i] != history[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    /**
+     * @param max_byte_size Host memory budget for the states of suspended sessions.
+     */
+    explicit ChatSessionPool(size_t max_byte_size) : m_max_byte_size(max_byte_size) {}
+
+    /**
+     * Copies the current session of an infer request to host memory.
+     * @param request Infer request holding the session in its states.
+     * @param history Chat history of the session.
+     * @param kv_cache_state Tokens contained in the KV cache of the session.
+     * @param adapter_controller Controller of LoRA adapters of the pipeline, whose states are not saved.
+     */
+    static Session save(ov::InferRequest& request,
+                        const ChatHistory& history,
+                        const utils::KVCacheState& kv_cache_state,
+                        std::optional<AdapterController>& adapter_controller) {
+        Session session{history, kv_cache_state, _copy_to_host(request.get_tensor("attention_mask")), {}};
+        for (auto& state : request.query_state()) {
+            if (adapter_controller && adapter_controller->has_state_name(state.get_name())) {
+                continue;
+            }
+            session.states.emplace_back(state.get_name(), _copy_to_host(state.get_state()));
+        }
+        return session;
+    }
+
+    /**
+     * Loads a saved session into the states of an infer request.
+     */
+    static void restore(ov::InferRequest& request, const Session& session) {
+        for (auto& state : request.query_state()) {
+            auto it = std::find_if(session.states.begin(), session.states.end(), [&state](const auto& saved_state) {
+                return saved_state.first == state.get_name();
+            });
+            if (it != session.states.end()) {
+                state.set_state(it->second);
+            }
+        }
+        auto attention_mask = request.get_tensor("attention_mask");
+        attention_mask.set_shape(session.attention_mask.get_shape());
+        session.attention_mask.copy_to(attention_mask);
+    }
+
+    /**
+     * Suspends a session, evicting the least recently suspended sessions if the memory budget is exceeded.
+     * A session which does not fit the budget alone is dropped.
+     */
+    void put(Session session) {
+        const size_t byte_size = session.get_byte_size();
+        if (byte_size > m_max_byte_size) {
+            return;
+        }
+        while (m_byte_size + byte_size > m_max_byte_size) {
+            m_byte_size -= m_sessions.back().get_byte_size();
+            m_sessions.pop_back();
+        }
+        m_sessions.push_front(std::move(session));
+        m_byte_size += byte_size;
+    }
+
+    /**
+     * Removes the session to be resumed by a chat history from the pool.
+     * @param history Chat history to be generated for.
+     * @return The session with the longest history which is a prefix of the given one, if there is any.
+     */
+    std::optional<Session> take(const ChatHistory& history) {
+        auto best = m_sessions.end();
+        for (auto it = m_sessions.begin(); it != m_sessions.end(); ++it) {
+            if (_is_prefix(it->history, history) && (best == m_sessions.end() || it->history.size() > best->history.size())) {
+                best = it;
+            }
+        }
+        if (best == m_sessions.end()) {
+            return std::nullopt;
+        }
+        Session session = std::move(*best);
+        m_sessions.erase(best);
+        m_byte_size -= session.get_byte_size();
+        return session;
+    }
+
+    void clear() {
+        m_sessions.clear();
+        m_byte_size = 0;
+    }
+
+    size_t size() const {
+        return m_sessions.size();
+    }
+};
+
+}  // namespace ov::genai
@@ -66,8 +66,18 @@ StatefulLLMPipeline::StatefulLLMPipeline(
         m_kv_cache_state.seq_length_axis = kv_pos.seq_len;
 
     auto [filtered_properties_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+    auto chat_sessions_cache_size_it = filtered_properties_without_gguf.find(ov::genai::chat_sessions_cache_size.name());
+    if (chat_sessions_cache_size_it != filtered_properties_without_gguf.end()) {
+        // with the full chat history used as a prompt on each generation there is no KV cache to resume
+        if (!m_use_full_chat_history) {
+            m_chat_sessions.emplace(chat_sessions_cache_size_it->second.as<size_t>());
+        }
+        filtered_properties_without_gguf.erase(chat_sessions_cache_size_it);
+    }
     auto filtered_properties = extract_adapters_from_properties(filtered_properties_without_gguf, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
+        OPENVINO_ASSERT(m_generation_config.adapters->get_mode() != AdapterConfig::MODE_PER_REQUEST,
+                        "AdapterConfig::MODE_PER_REQUEST is supported by ContinuousBatchingPipeline only");
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
         m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
     }
@@ -259,6 +269,17 @@ DecodedResults StatefulLLMPipeline::generate(
         }
     }
 
+    if (!is_history_continuation && m_chat_sessions) {
+        if (!m_kv_cache_state.get_state().empty()) {
+            m_chat_sessions->put(ChatSessionPool::save(m_model_runner, m_history, m_kv_cache_state, m_adapter_controller));
+        }
+        if (auto session = m_chat_sessions->take(history)) {
+            ChatSessionPool::restore(m_model_runner, *session);
+            m_kv_cache_state = std::move(session->kv_cache_state);
+            is_history_continuation = true;
+        }
+    }
+
     if (!is_history_continuation) {
         reset_kv_state();
         m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
@@ -353,6 +374,12 @@ EncodedResults StatefulLLMPipeline::generate(
     GenerationConfig config = resolve_generation_config(generation_config);
 
     auto batch_size = input_ids.get_shape().at(0);
+    if (batch_size > 1) {
+        // prompts padded beyond the longest one waste the compute of the whole batch
+        auto trimmed_inputs = remove_common_padding(input_ids, attention_mask);
+        input_ids = trimmed_inputs.input_ids;
+        attention_mask = trimmed_inputs.attention_mask;
+    }
 
     if (m_is_npu) {
         OPENVINO_ASSERT(batch_size == 1u, "Currently only batch size equal to 1 is supported for NPU device!");
@@ -503,6 +530,9 @@ void StatefulLLMPipeline::reset_kv_state() {
 
 void StatefulLLMPipeline::finish_chat() {
     is_chat_conversation = false;
+    if (m_chat_sessions) {
+        m_chat_sessions->clear();
+    }
     m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
     bool have_state = 0 != m_model_runner.get_tensor("attention_mask").get_size();
     if (!m_kv_cache_state.get_state().empty() || have_state) {
@@ -4,6 +4,7 @@
 
 #include <limits>
 
+#include "llm/chat_session_pool.hpp"
 #include "llm/pipeline_base.hpp"
 #include "lm_encoding.hpp"
 #include "sampling/sampler.hpp"
@@ -29,6 +30,8 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     bool m_is_npu = false;
     // include reflection of tokens contained in the kv cache and amount of tokens, which are needed to trim from kv cache on the next step of chat
     utils::KVCacheState m_kv_cache_state;
+    // suspended chat sessions, which are resumed when a chat history continuing them is passed
+    std::optional<ChatSessionPool> m_chat_sessions;
 
     void reset_kv_state();
 public:
@@ -95,12 +95,13 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
     auto active_sequence_groups{sequence_groups};
 
-    auto stream_generated_tokens = [&streamer_ptr, &generations, &active_sequence_groups]() {
+    // reused between steps, so that streaming does not allocate
+    GenerationOutputs generation_outputs;
+    auto stream_generated_tokens = [&streamer_ptr, &generations, &active_sequence_groups, &generation_outputs]() {
         GenerationHandle& handle = generations.at(0);
-        if (streamer_ptr && handle->can_read()) {
-            std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read();
+        if (streamer_ptr && handle->can_read() && handle->read_available(generation_outputs)) {
             OPENVINO_ASSERT(generation_outputs.size() <= 1);
-            if (!generation_outputs.empty()) {
+            if (!generation_outputs.empty() && !generation_outputs.begin()->second.generated_ids.empty()) {
                 auto streaming_status = streamer_ptr->write(generation_outputs.begin()->second.generated_ids);
                 if (streaming_status != ov::genai::StreamingStatus::RUNNING) {
                     streaming_status == ov::genai::StreamingStatus::CANCEL ? handle->cancel() : handle->stop();
@@ -173,9 +174,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         sequence_group->set_output_seq_len(output_sequence_len);
     }
 
-    std::map<size_t, size_t> beam_offets;
+    std::map<size_t, size_t> beam_offsets;
     for (size_t i = 0; i < sequence_groups.size(); i++)
-        beam_offets.insert({sequence_groups.at(i)->get_request_id(), i});
+        beam_offsets.insert({sequence_groups.at(i)->get_request_id(), i});
 
     SamplerOutput sampler_output = sampler.sample(sequence_groups, logits);
     free_non_running_requests(); // handle sampler output
@@ -198,8 +199,7 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         ov::Tensor new_input_ids(ov::element::i64, {total_num_tokens, 1});
         int64_t * input_ids_data = new_input_ids.data<int64_t>();
 
-        std::vector<int32_t> next_beams;
-        size_t current_batch_size = 0;
+        std::map<size_t, std::map<size_t, int32_t>> beam_idxs;
 
         for (auto& sequence_group : active_sequence_groups) {
             std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
@@ -207,7 +207,7 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
             size_t num_scheduled_tokens = sequence_group->get_num_scheduled_tokens();
             size_t group_position_id = sequence_group->get_num_processed_tokens();
 
-            std::map<size_t, int32_t> beam_idxs = sampler.get_beam_idxs(sequence_group);
+            beam_idxs[sequence_group->get_request_id()] = sampler.get_beam_idxs(sequence_group);
 
             for (size_t seq_id = 0; seq_id < num_running_sequences; ++seq_id) {
                 Sequence::CPtr sequence = running_sequences[seq_id];
@@ -221,17 +221,10 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
 
                 // apply strides to shift to a next sequence
                 input_ids_data += num_scheduled_tokens;
-
-                // for different sequences iteration of beams started from 0, but we collect it to one input_ids
-                next_beams.push_back(beam_idxs[sequence->get_id()] + beam_offets.at(sequence_group->get_request_id()));
             }
-
-            current_batch_size += num_running_sequences;
         }
 
-        for (size_t i = 0; i < active_sequence_groups.size(); i++) {
-            beam_offets[active_sequence_groups.at(i)->get_request_id()] = i == 0 ? 0 : (active_sequence_groups.at(i - 1)->num_running_seqs() + beam_offets[i - 1]);
-        }
+        std::vector<int32_t> next_beams = get_next_beam_idx(active_sequence_groups, beam_idxs, beam_offsets);
 
         if (m_embedding) {
             CircularBufferQueueElementGuard<EmbeddingsRequest> embeddings_request_guard(m_embedding->get_request_queue().get());
@@ -357,6 +350,69 @@ TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, utils:
 }
 
 
+std::vector<int32_t> get_next_beam_idx(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                       const std::map<size_t, std::map<size_t, int32_t>>& beam_idxs,
+                                       std::map<size_t, size_t>& beam_offsets) {
+    std::vector<int32_t> next_beams;
+    std::map<size_t, size_t> next_beam_offsets;
+    size_t current_batch_size = 0;
+    for (const auto& sequence_group : sequence_groups) {
+        const size_t request_id = sequence_group->get_request_id();
+        const std::map<size_t, int32_t>& group_beam_idxs = beam_idxs.at(request_id);
+        next_beam_offsets[request_id] = current_batch_size;
+
+        for (const auto& sequence : sequence_group->get_running_sequences()) {
+            // for different sequences iteration of beams started from 0, but we collect it to one input_ids
+            next_beams.push_back(group_beam_idxs.at(sequence->get_id()) + beam_offsets.at(request_id));
+        }
+        current_batch_size += sequence_group->num_running_seqs();
+    }
+
+    // rows of finished sequences are not gathered by beam_idx, so they are dropped from the KV cache and the batch
+    // shrinks as sequences finish
+    beam_offsets = std::move(next_beam_offsets);
+    return next_beams;
+}
+
+TokenizedInputs remove_common_padding(const ov::Tensor& input_ids, const ov::Tensor& attention_mask) {
+    OPENVINO_ASSERT(input_ids.get_element_type() == ov::element::i64 && attention_mask.get_element_type() == ov::element::i64,
+                    "Expected input_ids and attention_mask of i64 type");
+    OPENVINO_ASSERT(input_ids.get_shape() == attention_mask.get_shape(), "input_ids and attention_mask must have the same shape");
+    const size_t batch_size = attention_mask.get_shape().at(0);
+    const size_t sequence_length = attention_mask.get_shape().at(1);
+    const int64_t* mask_data = attention_mask.data<const int64_t>();
+
+    auto is_padding_column = [&](size_t column) {
+        for (size_t batch = 0; batch < batch_size; ++batch) {
+            if (mask_data[batch * sequence_length + column] != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    size_t begin = 0, end = sequence_length;
+    while (begin < end && is_padding_column(begin)) {
+        ++begin;
+    }
+    while (end > begin && is_padding_column(end - 1)) {
+        --end;
+    }
+    if (begin == end || end - begin == sequence_length) {
+        return {input_ids, attention_mask};
+    }
+
+    const size_t new_sequence_length = end - begin;
+    TokenizedInputs trimmed{ov::Tensor(ov::element::i64, {batch_size, new_sequence_length}),
+                            ov::Tensor(ov::element::i64, {batch_size, new_sequence_length})};
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        const size_t src_offset = batch * sequence_length + begin, dst_offset = batch * new_sequence_length;
+        std::copy_n(input_ids.data<const int64_t>() + src_offset, new_sequence_length, trimmed.input_ids.data<int64_t>() + dst_offset);
+        std::copy_n(mask_data + src_offset, new_sequence_length, trimmed.attention_mask.data<int64_t>() + dst_offset);
+    }
+    return trimmed;
+}
+
+
 void align_kv_cache_and_history(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state) {
     // KV cache in model already contains prompts and answers from previous iterations.
     // So only new prompt wrapped into chat template to be sent into model. Tokenizer always returns
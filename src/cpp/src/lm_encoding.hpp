@@ -33,5 +33,27 @@ void align_kv_cache_and_history(const ov::Tensor& new_chat_tokens, utils::KVCach
 
 TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state);
 
+/**
+ * Computes beam_idx of the next inference, the rows of the batch of the previous inference the running sequences
+ * continue from. The rows of the finished sequence groups are not gathered, so the batch shrinks as groups finish.
+ * @param sequence_groups Running sequence groups in the order of the batch of the next inference.
+ * @param beam_idxs Beams of its sequence group each running sequence continues from, by the sequence ids, per request id.
+ * @param beam_offsets Rows of the sequence groups in the batch of the previous inference by the request ids, replaced
+ * by their rows in the batch of the next inference.
+ * @return beam_idx of the next inference.
+ */
+std::vector<int32_t> get_next_beam_idx(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                       const std::map<size_t, std::map<size_t, int32_t>>& beam_idxs,
+                                       std::map<size_t, size_t>& beam_offsets);
+
+/**
+ * Removes the columns of a batch of prompts which are padding in all of the prompts, so that the prompts are processed
+ * without the padding none of them needs.
+ * @param input_ids Padded prompts of [batch_size, sequence_length] shape.
+ * @param attention_mask Attention mask of the prompts, 0 for padding tokens.
+ * @return The prompts and the attention mask without the common padding, the original tensors if there is none.
+ */
+TokenizedInputs remove_common_padding(const ov::Tensor& input_ids, const ov::Tensor& attention_mask);
+
 }
 }
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <set>
 #include <map>
+#include <list>
 #include <string>
 #include <vector>
 #include <fstream>
@@ -15,6 +16,9 @@
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <cstring>
+#include <string_view>
+#include <filesystem>
 
 #include "openvino/op/add.hpp"
 #include "openvino/op/multiply.hpp"
@@ -42,6 +46,7 @@
 #include "utils.hpp"
 #include "lora/common.hpp"
 #include "lora/names_mapping.hpp"
+#include "lora/shared_file_content_cache.hpp"
 
 #ifdef ENABLE_GGUF
 #include <algorithm>
@@ -200,6 +205,31 @@ LoRAConstantTensors group_lora_constant_tensors(const ConstantMap& tensors, cons
     return result;
 }
 
+// Tensors of a Safetensors adapter file grouped by layers.
+struct SafetensorsContent {
+    LoRATensors tensors;
+    LoRAConstantTensors constant_tensors;
+};
+
+SafetensorsContent group_safetensors_content(ConstantMap safetensor_content) {
+    SafetensorsContent content;
+    content.constant_tensors = group_lora_constant_tensors(safetensor_content, default_lora_constant_patterns());
+    for (const auto& constant_tensor : content.constant_tensors) {
+        safetensor_content.erase(constant_tensor.first);
+    }
+    content.tensors = group_lora_tensors(safetensor_content, default_lora_patterns());
+    return content;
+}
+
+// Reads and groups the tensors of a Safetensors adapter file once for all adapters loaded from the same file while
+// any of them exists, so they share the file mapping and the pages of the tensors already applied to a model.
+std::shared_ptr<const SafetensorsContent> read_shared_safetensors_content(const std::filesystem::path& filename) {
+    static SharedFileContentCache<SafetensorsContent> cache;
+    return cache.get(filename, [](const std::filesystem::path& path) {
+        return group_safetensors_content(read_safetensors(path));
+    });
+}
+
 
 // Squeeze all dimensions from the right of the shape producing a tensor of 2D shape.
 NodePtr squeeze_2d (const ov::Output<ov::Node>& input) {
@@ -238,7 +268,7 @@ struct LoRAParameters {
     ov::Dimension rank;         // accumulated LoRA rank, could be dynamic if rank is not known or DYNAMIC mode is applied
     ov::element::Type type;     // element type of a tensor that will be applied to the model, negotiated based on multiple LoRA adapters
     bool fine_grained_alpha;    // use 1D tensor of the same rank for alpha instead of a scalar to blend multiple weighted LoRAs
-    // TODO: flag to have various alphas over the batch
+    bool per_token_alpha = false;   // use a table of alphas with a row per adapter combination selected for each token of the batch
 };
 
 using LoRAParametersGetter = std::function<std::optional<LoRAParameters>(NodePtr node)>;
@@ -320,6 +350,7 @@ struct LoRAParametersByWeightGetter {
     std::vector<LoRAWeightGetter> weight_getter;
     bool dynamic_lora_rank = true;
     bool fine_grained_alpha = true;
+    bool per_token_alpha = false;
     ov::element::Type type;
 
     std::optional<LoRAParameters> operator() (NodePtr node) const {
@@ -356,6 +387,7 @@ struct LoRAParametersByWeightGetter {
         result.rank = rank;
         result.type = type;
         result.fine_grained_alpha = fine_grained_alpha;
+        result.per_token_alpha = per_token_alpha;
         return result;
     }
 };
@@ -444,7 +476,8 @@ struct LoRAWeightStateGetter {
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.A = model->get_variables().size();
             var_ids.alpha = ov::op::util::VariableInfo{
-                params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{},
+                params->per_token_alpha ? ov::PartialShape{ov::Dimension::dynamic(), params->rank} :
+                    params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{},
                 ov::element::f32,   // alpha is always f32 because it is set from host as float data type
                 variable_id_prefix + ".alpha"
             };
@@ -973,6 +1006,65 @@ public:
 };
 
 
+// Transformation that modifies the base model inserting LoRA matrix multiplications alongside with the original MatMul,
+// where each token of the batch uses its own combination of adapters.
+// A and B stack the ranks of all resident adapters. Each row of the alpha table holds the alphas of one combination
+// of adapters in their ranks and zeros in the ranks of the other adapters, so the row gathered by the adapter index
+// of a token selects the adapters of the token.
+class LoRAPerTokenTransform : public LoRATransformBase {
+public:
+
+    OPENVINO_RTTI("LoRAPerTokenTransform", "genai", LoRATransformBase);
+
+    LoRAPerTokenTransform(const LoRAWeightByNodeGetter& lora_getter, std::shared_ptr<v0::Parameter> adapter_indices) :
+        LoRATransformBase(lora_getter),
+        adapter_indices(adapter_indices) {}
+
+    bool apply (NodePtr node, const LoRANode& lora_weight) override {
+        OPENVINO_ASSERT(std::dynamic_pointer_cast<v0::MatMul>(node),
+            "AdapterConfig::MODE_PER_REQUEST supports LoRA adapters for MatMul layers only, got ", node);
+        auto activations = node->input_value(0);    // FIXME: consider MatMul.transpose_a
+        auto target = node->output(0);
+        auto target_type = target.get_element_type();
+        auto consumers = target.get_target_inputs();
+        auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+
+        // the tokens the logits are computed for are gathered by sampled_tokens_indices, so are their adapter indices
+        ov::Output<ov::Node> token_adapter_indices = adapter_indices;
+        if(auto gather = std::dynamic_pointer_cast<v8::Gather>(activations.get_node_shared_ptr())) {
+            auto indices = std::dynamic_pointer_cast<v0::Parameter>(gather->get_input_node_shared_ptr(1));
+            if(indices && indices->get_friendly_name() == "sampled_tokens_indices") {
+                token_adapter_indices = register_new_node<v8::Gather>(adapter_indices, indices, axis);
+            }
+        }
+
+        auto to_target_type = [target_type](NodePtr input) -> NodePtr {
+            if(input->get_output_element_type(0) != target_type) {
+                return std::make_shared<v0::Convert>(input, target_type);
+            }
+            return input;
+        };
+
+        NodePtr lora_a = std::make_shared<v0::MatMul>(activations, to_target_type(lora_weight.A), false, true);
+        // [tokens, rank] alphas are reshaped to the token dimensions of the activations
+        NodePtr alpha = std::make_shared<v8::Gather>(to_target_type(lora_weight.alpha), token_adapter_indices, axis);
+        alpha = std::make_shared<v1::Reshape>(alpha, std::make_shared<v3::ShapeOf>(lora_a), false);
+        NodePtr lora_b = std::make_shared<v0::MatMul>(std::make_shared<v1::Multiply>(lora_a, alpha), to_target_type(lora_weight.B), false, true);
+        NodePtr replacement = std::make_shared<v1::Add>(target, lora_b);
+
+        replacement->get_output_tensor(0).add_names(target.get_names());
+        for (auto consumer : consumers) {
+            consumer.replace_source_output(replacement->output(0));
+        }
+
+        return true;
+    }
+
+private:
+    std::shared_ptr<v0::Parameter> adapter_indices;
+};
+
+
 std::shared_ptr<v0::Constant> alpha_as_constant(float alpha) {
     return v0::Constant::create(ov::element::f32, ov::Shape{1}, {alpha});
 }
@@ -1041,23 +1133,21 @@ public:
         OPENVINO_ASSERT(std::filesystem::exists(path), "LoRA adapter path does not exist: ", path.string());
         OPENVINO_ASSERT(path.extension().string() == ".safetensors", "Expected .safetensors file, got: ", path.string());
 
-        auto safetensor_content = read_safetensors(path);
-        constant_tensors = group_lora_constant_tensors(safetensor_content, default_lora_constant_patterns());
-        for (const auto& constant_tensor : constant_tensors) {
-            safetensor_content.erase(constant_tensor.first);
-        }
-        tensors = group_lora_tensors(safetensor_content, default_lora_patterns());
+        content = read_shared_safetensors_content(path);
     }
 
-    SafetensorsAdapterImpl(const ov::Tensor& safetensor)
-        : tensors(group_lora_tensors(safetensor_to_constant_map(safetensor), default_lora_patterns())) {}
+    SafetensorsAdapterImpl(const ov::Tensor& safetensor) {
+        auto tensor_content = std::make_shared<SafetensorsContent>();
+        tensor_content->tensors = group_lora_tensors(safetensor_to_constant_map(safetensor), default_lora_patterns());
+        content = tensor_content;
+    }
 
     const LoRATensors& get_tensors() const override {
-        return tensors;
+        return content->tensors;
     }
 
     const LoRAConstantTensors& get_constant_tensors() const override {
-        return constant_tensors;
+        return content->constant_tensors;
     }
 
     bool eq(const AdapterImpl* other) const override {
@@ -1069,8 +1159,8 @@ public:
 
 private:
 
-    LoRATensors tensors;
-    LoRAConstantTensors constant_tensors;
+    // shared with the other adapters loaded from the same file
+    std::shared_ptr<const SafetensorsContent> content;
 };
 
 
@@ -1287,6 +1377,35 @@ struct AdapterControllerImpl {
     bool need_full_apply = true;
     InferRequestSignatureCache lora_state_evaluators;
 
+    // Adapters applicable to a layer with their alphas, which are set in the state of the layer.
+    struct AppliedLayerAdapters {
+        std::vector<Adapter> adapters;
+        std::vector<float> alphas;
+    };
+    std::map<std::string, AppliedLayerAdapters> applied_layer_adapters;
+
+    // A and B recently concatenated for a layer from the given adapters, the most recently used first.
+    struct CachedLayerTensors {
+        std::vector<Adapter> adapters;
+        LoRAParts<ov::Tensor> tensors;
+    };
+    std::map<std::string, std::list<CachedLayerTensors>> layer_tensors_cache;
+    static constexpr size_t max_cached_layer_tensors = 4;
+
+    // MODE_PER_REQUEST: adapters stacked in the state in this order, the least recently used ones are evicted first
+    struct ResidentAdapter {
+        Adapter adapter;
+        size_t last_used_step;
+    };
+    std::vector<ResidentAdapter> resident_adapters;
+    // the adapters the model was transformed with, LoRA states exist only for the layers of these adapters
+    std::vector<Adapter> transformed_adapters;
+    // ranks each resident adapter takes in the stacked tensors of a layer, 0 if it has no tensors for the layer
+    std::map<std::string, std::vector<size_t>> resident_ranks;
+    // configs of the alpha table rows set in the state, the row 0 disables all adapters
+    std::vector<AdapterConfig> alpha_rows;
+    size_t current_step = 0;
+
     // Stores the actual LoRA weight getter used for Constant tensor replacement
     // Needed to track which LoRA tensors were actually applied to suppress unused tensor warnings
     std::shared_ptr<LoRAWeightGetterDefault<NodePtr, NodePtr>> const_getter_impl;
@@ -1298,6 +1417,7 @@ struct AdapterControllerImpl {
         LoRAConstantGetter const_getter;
         LoRAParametersByWeightGetter params_getter;
         params_getter.type = ov::element::dynamic;
+        transformed_adapters = current_config.get_adapters();
 
         for(auto const& adapter : current_config.get_adapters()) {
             auto adapter_impl = get_adapter_impl(adapter);
@@ -1377,6 +1497,15 @@ struct AdapterControllerImpl {
             // Fuse mode
             pm.register_pass<LoRAFuseTransform>(weight_as_constant);
             pm.register_pass<LoRAReplaceConstantTransformStatic>(const_replacement_getter);
+        } else if(mode == AdapterConfig::MODE_PER_REQUEST) {
+            // State mode with adapters selected per token
+            OPENVINO_ASSERT(!const_getter, "AdapterConfig::MODE_PER_REQUEST does not support LoRA adapters with constants");
+            params_getter.per_token_alpha = true;
+            auto adapter_indices = std::make_shared<v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+            adapter_indices->set_friendly_name("lora_adapter_indices");
+            adapter_indices->output(0).get_tensor().set_names({"lora_adapter_indices"});
+            model->add_parameters({adapter_indices});
+            pm.register_pass<LoRAPerTokenTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids), adapter_indices);
         } else {
             OPENVINO_THROW("Unrecognized AdapterConfig::Mode was used: ", mode);
         }
@@ -1422,7 +1551,7 @@ struct AdapterControllerImpl {
             diff.alpha = true;
         } else {
             for(auto const& adapter: adapters1) {
-                diff.alpha = config1.get_alpha(adapter) != config2.get_alpha(adapter);
+                diff.alpha = diff.alpha || config1.get_alpha(adapter) != config2.get_alpha(adapter);
             }
         }
         return diff;
@@ -1430,6 +1559,8 @@ struct AdapterControllerImpl {
 
     void apply (ov::InferRequest& infer_request, std::optional<AdapterConfig> config) {
         // FIXME: If a part of LoRA state tensors are not set here, then need to carefully reset state in LLMPipeline where global reset is called after the generation
+        OPENVINO_ASSERT(current_config.get_mode() != AdapterConfig::MODE_PER_REQUEST,
+            "AdapterConfig::MODE_PER_REQUEST is supported by ContinuousBatchingPipeline only, which applies adapters per request in each step");
         ConfigChanged diff;
         if(config) {
             diff = compare_configs(current_config, *config);
@@ -1443,6 +1574,7 @@ struct AdapterControllerImpl {
         }
         if(need_full_apply) {
             need_full_apply = false;
+            applied_layer_adapters.clear();
             set_new_adapter_tensors(infer_request);
         } else if(diff) {
             if(diff.adapter) {
@@ -1457,6 +1589,182 @@ struct AdapterControllerImpl {
         return variable_names.count(name);
     }
 
+    static bool same_adapters_and_alphas(const AdapterConfig& config1, const AdapterConfig& config2) {
+        const auto& adapters1 = config1.get_adapters(), adapters2 = config2.get_adapters();
+        if(adapters1 != adapters2) {
+            return false;
+        }
+        for(const auto& adapter: adapters1) {
+            if(config1.get_alpha(adapter) != config2.get_alpha(adapter)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns the adapters used by a request in MODE_PER_REQUEST, std::nullopt means the adapters of the current config
+    const AdapterConfig& get_request_config(const std::optional<AdapterConfig>& config) const {
+        OPENVINO_ASSERT(current_config.get_mode() == AdapterConfig::MODE_PER_REQUEST,
+            "Adapters can be set per request only if AdapterConfig::MODE_PER_REQUEST is used");
+        const AdapterConfig& request_config = config ? *config : current_config;
+        for(const auto& adapter: request_config.get_adapters()) {
+            OPENVINO_ASSERT(transformed_adapters.end() != std::find(transformed_adapters.begin(), transformed_adapters.end(), adapter),
+                "A request uses an adapter which was not passed to the pipeline. In AdapterConfig::MODE_PER_REQUEST requests "
+                "can use only the adapters the pipeline is created with");
+        }
+        return request_config;
+    }
+
+    size_t get_per_request_id(const std::optional<AdapterConfig>& config) const {
+        const AdapterConfig& request_config = get_request_config(config);
+        if(!request_config) {
+            return 0;
+        }
+        // adapters are identified by their positions in the pipeline config, so the id does not depend on their order in the request
+        std::vector<std::pair<int64_t, float>> indexed_alphas;
+        for(const auto& adapter: request_config.get_adapters()) {
+            auto index = std::find(transformed_adapters.begin(), transformed_adapters.end(), adapter) - transformed_adapters.begin();
+            indexed_alphas.emplace_back(index, request_config.get_alpha(adapter));
+        }
+        std::sort(indexed_alphas.begin(), indexed_alphas.end());
+        std::vector<int64_t> content;
+        for(const auto& [index, alpha]: indexed_alphas) {
+            uint32_t alpha_bits;
+            std::memcpy(&alpha_bits, &alpha, sizeof(alpha_bits));
+            content.push_back(index);
+            content.push_back(alpha_bits);
+        }
+        const char* data = reinterpret_cast<const char*>(content.data());
+        size_t id = std::hash<std::string_view>{}(std::string_view(data, content.size() * sizeof(content[0])));
+        // 0 is reserved for requests without adapters
+        return id == 0 ? 1 : id;
+    }
+
+    std::vector<int32_t> apply_per_request(ov::InferRequest& infer_request, const std::vector<std::optional<AdapterConfig>>& configs) {
+        ++current_step;
+
+        // row 0 of the alpha tables disables all adapters, other rows correspond to the distinct configs of the batch
+        std::vector<AdapterConfig> step_rows;
+        std::vector<int32_t> row_indices;
+        row_indices.reserve(configs.size());
+        for(const auto& config: configs) {
+            const AdapterConfig& request_config = get_request_config(config);
+            if(!request_config) {
+                row_indices.push_back(0);
+                continue;
+            }
+            auto row = std::find_if(step_rows.begin(), step_rows.end(), [&request_config](const AdapterConfig& row_config) {
+                return same_adapters_and_alphas(row_config, request_config);
+            });
+            if(row == step_rows.end()) {
+                row = step_rows.insert(step_rows.end(), request_config);
+            }
+            row_indices.push_back(static_cast<int32_t>(row - step_rows.begin()) + 1);
+        }
+
+        std::vector<Adapter> missing_adapters;
+        for(const auto& row_config: step_rows) {
+            for(const auto& adapter: row_config.get_adapters()) {
+                auto resident = std::find_if(resident_adapters.begin(), resident_adapters.end(), [&adapter](const ResidentAdapter& resident) {
+                    return resident.adapter == adapter;
+                });
+                if(resident != resident_adapters.end()) {
+                    resident->last_used_step = current_step;
+                } else if(missing_adapters.end() == std::find(missing_adapters.begin(), missing_adapters.end(), adapter)) {
+                    missing_adapters.push_back(adapter);
+                }
+            }
+        }
+
+        bool resident_adapters_changed = need_full_apply || !missing_adapters.empty();
+        if(resident_adapters_changed) {
+            // evict the least recently used adapters which are not used in this step to make room for the missing ones
+            const size_t max_resident_adapters = current_config.get_max_resident_adapters();
+            while(resident_adapters.size() + missing_adapters.size() > max_resident_adapters) {
+                auto lru = std::min_element(resident_adapters.begin(), resident_adapters.end(), [](const ResidentAdapter& a, const ResidentAdapter& b) {
+                    return a.last_used_step < b.last_used_step;
+                });
+                if(lru == resident_adapters.end() || lru->last_used_step == current_step) {
+                    break;
+                }
+                resident_adapters.erase(lru);
+            }
+            for(const auto& adapter: missing_adapters) {
+                resident_adapters.push_back({adapter, current_step});
+            }
+            need_full_apply = false;
+        }
+
+        bool rows_changed = step_rows.size() != alpha_rows.size() ||
+            !std::equal(step_rows.begin(), step_rows.end(), alpha_rows.begin(), same_adapters_and_alphas);
+        if(resident_adapters_changed || rows_changed) {
+            alpha_rows = std::move(step_rows);
+            set_resident_adapter_tensors(infer_request, /*alpha_only=*/!resident_adapters_changed);
+        }
+        return row_indices;
+    }
+
+    // Sets the stacked A and B of the resident adapters and the table of alphas for the rows of the current batch
+    void set_resident_adapter_tensors(ov::InferRequest& infer_request, bool alpha_only) {
+        auto state = infer_request.query_state();
+        std::map<std::string, size_t> state_name_to_index;
+        for(size_t i = 0; i < state.size(); ++i) {
+            state_name_to_index[state[i].get_name()] = i;
+        }
+
+        std::vector<LoRAWeightGetter> weight_getters;
+        if(!alpha_only) {
+            weight_getters.reserve(resident_adapters.size());
+            for(const auto& resident: resident_adapters) {
+                weight_getters.emplace_back(
+                    LoRAWeightGetterDefault<LoRAWeight, LoRANode>(&get_adapter_impl(resident.adapter)->get_tensors(),
+                                                                  current_config.get_tensor_name_prefix().value_or("")));
+            }
+        }
+
+        for(const auto& [name, lora_var_ids]: variable_ids) {
+            auto& ranks = resident_ranks[name];
+            if(!alpha_only) {
+                // adapters without tensors for the layer take no ranks in it
+                std::vector<LoRAWeight> lora_tensors;
+                std::vector<Adapter> layer_adapters;
+                ranks.assign(resident_adapters.size(), 0);
+                for(size_t i = 0; i < resident_adapters.size(); ++i) {
+                    if(auto lora_weight = weight_getters[i](name)) {
+                        OPENVINO_ASSERT(lora_weight->A);
+                        OPENVINO_ASSERT(lora_weight->B);
+                        ranks[i] = lora_weight->A->get_output_partial_shape(0)[0].get_length();
+                        lora_tensors.push_back(LoRAWeight(
+                            alpha_as_constant(1),
+                            std::dynamic_pointer_cast<v0::Constant>(lora_weight->A),
+                            std::dynamic_pointer_cast<v0::Constant>(lora_weight->B)
+                        ));
+                        layer_adapters.push_back(resident_adapters[i].adapter);
+                    }
+                }
+                auto new_tensors = get_concatenated_tensors(name, lora_var_ids, lora_tensors, layer_adapters);
+                state[state_name_to_index.at(lora_var_ids.A.variable_id)].set_state(new_tensors.A);
+                state[state_name_to_index.at(lora_var_ids.B.variable_id)].set_state(new_tensors.B);
+            }
+
+            const size_t rank = std::accumulate(ranks.begin(), ranks.end(), size_t(0));
+            ov::Tensor alpha_table(ov::element::f32, ov::Shape{alpha_rows.size() + 1, rank});
+            float* alpha_data = alpha_table.data<float>();
+            std::fill_n(alpha_data, alpha_table.get_size(), 0.0f);
+            for(size_t row = 0; row < alpha_rows.size(); ++row) {
+                const auto& row_adapters = alpha_rows[row].get_adapters();
+                float* row_data = alpha_data + (row + 1) * rank;
+                for(size_t i = 0; i < resident_adapters.size(); ++i) {
+                    if(ranks[i] && row_adapters.end() != std::find(row_adapters.begin(), row_adapters.end(), resident_adapters[i].adapter)) {
+                        std::fill_n(row_data, ranks[i], alpha_rows[row].get_alpha(resident_adapters[i].adapter));
+                    }
+                    row_data += ranks[i];
+                }
+            }
+            state[state_name_to_index.at(lora_var_ids.alpha.variable_id)].set_state(alpha_table);
+        }
+    }
+
     void set_new_adapter_alphas (ov::InferRequest& infer_request) {
         set_new_adapter_tensors(infer_request, /*alpha_only=*/true);
     }
@@ -1506,6 +1814,11 @@ struct AdapterControllerImpl {
             set_lora_tensors(state, lora_var_ids.first, lora_var_ids.second, lora_indices, weight_getters, alpha_only);
         }
 
+        if(alpha_only) {
+            // constants don't depend on alphas
+            return;
+        }
+
         for (const auto& [const_name, var_info] : constant_variable_ids) {
 
             size_t const_lora_index = state_name_to_index.at(var_info.variable_id);
@@ -1533,13 +1846,16 @@ struct AdapterControllerImpl {
 
     }
 
-    std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters) {
+    std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters, std::vector<Adapter>* applicable_adapters = nullptr) {
         const auto& adapters = current_config.get_adapters();
         OPENVINO_ASSERT(weight_getters.size() == adapters.size());
         std::vector<LoRAWeight> result;
         result.reserve(weight_getters.size());
         for(size_t i = 0; i < adapters.size(); ++i) {
             if(auto lora_tensors = weight_getters[i](lora_name)) {
+                if(applicable_adapters) {
+                    applicable_adapters->push_back(adapters[i]);
+                }
                 // TODO: Is it practical to use alpha from the adapter file itself. In the current code it is ignored and only alpha from config is used.
                 OPENVINO_ASSERT(lora_tensors->A);
                 OPENVINO_ASSERT(lora_tensors->B);
@@ -1719,6 +2035,8 @@ struct AdapterControllerImpl {
         return shape;
     }
 
+    // Sets the state of a layer updating only the parts affected by the change of the adapters applicable to the layer
+    // or their alphas since the last call. A and B are taken from the cache if they were computed for the same adapters recently.
     void set_lora_tensors(
         std::vector<VariableState>& state,
         const std::string& name,
@@ -1727,17 +2045,68 @@ struct AdapterControllerImpl {
         const std::vector<LoRAWeightGetter>& weight_getters,
         bool alpha_only
     ) {
+        AppliedLayerAdapters layer_adapters;
+        auto lora_tensors = collect_applicable_tensors(name, weight_getters, &layer_adapters.adapters);
+        for(const auto& adapter: layer_adapters.adapters) {
+            layer_adapters.alphas.push_back(current_config.get_alpha(adapter));
+        }
+
+        auto applied = applied_layer_adapters.find(name);
+        const bool adapters_changed = applied == applied_layer_adapters.end() || applied->second.adapters != layer_adapters.adapters;
+        if(!adapters_changed && applied->second.alphas == layer_adapters.alphas) {
+            return;
+        }
+        OPENVINO_ASSERT(!alpha_only || !adapters_changed, "LoRA adapters of layer ", name, " are changed when only alphas are expected to be changed");
+
+        if(adapters_changed) {
+            auto new_tensors = get_concatenated_tensors(name, lora_var_ids, lora_tensors, layer_adapters.adapters);
+            state[lora_indices.A].set_state(new_tensors.A);
+            state[lora_indices.B].set_state(new_tensors.B);
+        }
+
+        // alphas are broadcasted to the ranks of their adapters on host
+        size_t rank = 0;
+        for(const auto& lora_weight: lora_tensors) {
+            rank += lora_weight.A->get_shape()[0];
+        }
+        ov::Tensor alpha(lora_var_ids.alpha.data_type, ov::Shape{1, rank});
+        float* alpha_data = alpha.data<float>();
+        for(size_t i = 0; i < lora_tensors.size(); ++i) {
+            alpha_data = std::fill_n(alpha_data, lora_tensors[i].A->get_shape()[0], layer_adapters.alphas[i]);
+        }
+        state[lora_indices.alpha].set_state(alpha);
+
+        applied_layer_adapters[name] = std::move(layer_adapters);
+    }
+
+    LoRAParts<ov::Tensor> get_concatenated_tensors(
+        const std::string& name,
+        const LoRAVarIDs& lora_var_ids,
+        const std::vector<LoRAWeight>& lora_tensors,
+        const std::vector<Adapter>& adapters
+    ) {
+        auto& cached_tensors = layer_tensors_cache[name];
+        auto cached = std::find_if(cached_tensors.begin(), cached_tensors.end(), [&adapters](const CachedLayerTensors& cached) {
+            return cached.adapters == adapters;
+        });
+        if(cached != cached_tensors.end()) {
+            cached_tensors.splice(cached_tensors.begin(), cached_tensors, cached);
+            return cached_tensors.front().tensors;
+        }
+
         LoRAParts<ov::Tensor> lora_state_tensors{
             ov::Tensor(lora_var_ids.alpha.data_type, dynamic_to_static(lora_var_ids.alpha.data_shape)),
-            alpha_only ? ov::Tensor() : ov::Tensor(lora_var_ids.A.data_type, dynamic_to_static(lora_var_ids.A.data_shape)),
-            alpha_only ? ov::Tensor() : ov::Tensor(lora_var_ids.B.data_type, dynamic_to_static(lora_var_ids.B.data_shape))
+            ov::Tensor(lora_var_ids.A.data_type, dynamic_to_static(lora_var_ids.A.data_shape)),
+            ov::Tensor(lora_var_ids.B.data_type, dynamic_to_static(lora_var_ids.B.data_shape))
         };
-        auto new_tensors = prepare_lora_tensors(name, weight_getters, lora_state_tensors, /*set_empty_adapters=*/true, alpha_only);
-        state[lora_indices.alpha].set_state(new_tensors.alpha);
-        if(!alpha_only) {
-            state[lora_indices.A].set_state(new_tensors.A);
-            state[lora_indices.B].set_state(new_tensors.B);
+        auto new_tensors = lora_tensors.empty() ?
+            empty_adapters(lora_tensors, lora_state_tensors) :
+            concat_adapters(lora_tensors, lora_state_tensors, /*alpha_only=*/false);
+        cached_tensors.push_front(CachedLayerTensors{adapters, new_tensors});
+        if(cached_tensors.size() > max_cached_layer_tensors) {
+            cached_tensors.pop_back();
         }
+        return new_tensors;
     }
 
     LoRAParts<ov::Tensor> prepare_lora_tensors (
@@ -1809,6 +2178,16 @@ bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
 
+std::vector<int32_t> AdapterController::apply_per_request(ov::InferRequest request, const std::vector<std::optional<AdapterConfig>>& configs) {
+    OPENVINO_ASSERT(m_pimpl, "AdapterController was not configured to use adapters.");
+    return m_pimpl->apply_per_request(request, configs);
+}
+
+size_t AdapterController::get_per_request_id(const std::optional<AdapterConfig>& config) const {
+    OPENVINO_ASSERT(m_pimpl, "AdapterController was not configured to use adapters.");
+    return m_pimpl->get_per_request_id(config);
+}
+
 
 void AdapterConfig::set_mode(Mode _mode) {
     mode = _mode;
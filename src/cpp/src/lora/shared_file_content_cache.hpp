@@ -0,0 +1,82 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * @brief Shares the content loaded from a file by all its users while any of them holds it. Only weak pointers are kept,
+ * so the content is freed together with its last user. The file is identified by its canonical path, size and
+ * modification time to be loaded again if it is replaced.
+ */
+template <typename Content>
+class SharedFileContentCache {
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::weak_ptr<const Content>> m_contents;
+
+    static std::string get_key(const std::filesystem::path& filename) {
+        return std::filesystem::canonical(filename).string() + '|' +
+               std::to_string(std::filesystem::file_size(filename)) + '|' +
+               std::to_string(std::filesystem::last_write_time(filename).time_since_epoch().count());
+    }
+
+public:
+    /**
+     * @param filename Path to the file.
+     * @param load Function loading the content of the file, called if no user holds the content of the file.
+     * @return Content of the file shared with its other users.
+     */
+    template <typename LoadFunction>
+    std::shared_ptr<const Content> get(const std::filesystem::path& filename, LoadFunction&& load) {
+        const std::string key = get_key(filename);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_contents.find(key);
+            if (it != m_contents.end()) {
+                if (auto content = it->second.lock()) {
+                    return content;
+                }
+            }
+        }
+
+        // the file is loaded without holding the lock for different files to be loaded concurrently
+        std::shared_ptr<const Content> content = std::make_shared<const Content>(load(filename));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_contents.begin(); it != m_contents.end();) {
+            it = it->second.expired() ? m_contents.erase(it) : std::next(it);
+        }
+        auto& cached = m_contents[key];
+        if (auto cached_content = cached.lock()) {
+            // the same file was loaded concurrently
+            return cached_content;
+        }
+        cached = content;
+        return content;
+    }
+
+    /**
+     * @return Number of files whose content is held by any user.
+     */
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t num_contents = 0;
+        for (const auto& [key, content] : m_contents) {
+            num_contents += !content.expired();
+        }
+        return num_contents;
+    }
+};
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
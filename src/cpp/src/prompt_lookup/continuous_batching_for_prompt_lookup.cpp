@@ -3,6 +3,8 @@
 
 #include "continuous_batching_for_prompt_lookup.hpp"
 
+#include <unordered_set>
+
 namespace ov::genai {
 
 const int64_t PADDING_TOKEN_ID = -1;
@@ -19,49 +21,29 @@ ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated
     return result;
 }
 
-TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
-    if (num_pred_tokens == 0) {
-        return std::vector<int64_t>{};
-    }
-
-    const size_t input_length = input_ids.size();
-    if (max_ngram_size >= input_length) {
-        // Comparing the whole input_ids is not very meaningful until the ngram length reaches half the length of
-        // `input_ids`, because the ngrams will overlap with `input_ids`.
-        max_ngram_size = static_cast<int32_t>(input_length / 2);
-    }
-    for (int32_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
-        // extract last ngram_size tokens as search ngram
-        std::vector<int64_t> ngram = std::vector<int64_t>{input_ids.cend() - ngram_size, input_ids.cend()};
-
-        for (int32_t input_i = 0; input_i < static_cast<int32_t>(input_length) - ngram_size; input_i++) {
-            if (!std::equal(ngram.begin(), ngram.end(), input_ids.begin() + input_i)) {
-                continue;
-            }
-            auto start_candidate_idx = input_i + ngram.size();
-            // match found with the end at input_i
-            size_t available_num_pred = std::min(input_length - start_candidate_idx, num_pred_tokens);
-            // return candidates with length of available_num_pred
-            return std::vector<int64_t>{input_ids.cbegin() + start_candidate_idx,
-                                        input_ids.cbegin() + start_candidate_idx + available_num_pred};
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::_drop_finished_ngram_indexes() {
+    std::unordered_set<uint64_t> live_seq_ids;
+    for (const auto& request : m_requests) {
+        for (const auto& sequence : request->get_sequences()) {
+            live_seq_ids.insert(sequence->get_id());
         }
     }
-
-    return std::vector<int64_t>{};
+    for (auto it = m_ngram_indexes.begin(); it != m_ngram_indexes.end();) {
+        it = live_seq_ids.count(it->first) ? std::next(it) : m_ngram_indexes.erase(it);
+    }
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates_for_prompt_lookup() {
+    _drop_finished_ngram_indexes();
     for (auto& request : m_requests) {
-        const auto prompt = request->get_prompt_ids();
+        const auto& prompt = request->get_prompt_ids();
 
         size_t max_validation_len = 0;
         for (auto& running_sequence : request->get_running_sequences()) {
-            const auto generated_tokens = running_sequence->get_generated_ids();
+            const auto& generated_tokens = running_sequence->get_generated_ids();
             if (generated_tokens.empty()) {
                 continue;
             }
-            TokenIds full_input_ids = prompt;
-            full_input_ids.insert(full_input_ids.end(), generated_tokens.begin(), generated_tokens.end());
 
             size_t min_num_assistant_tokens = 0;
             const auto sampling_params = request->get_sampling_parameters();
@@ -70,7 +52,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate
                 const auto left_generated_len = request->get_max_new_tokens() - generated_len - 1;
                 min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
             }
-            TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
+            // the index is kept between steps, so only the tokens generated since the previous step are indexed
+            auto& ngram_index = m_ngram_indexes.try_emplace(running_sequence->get_id(), sampling_params.max_ngram_size).first->second;
+            ngram_index.update(prompt, generated_tokens);
+            TokenIds candidates = ngram_index.find_continuation(min_num_assistant_tokens);
 
             // Padding candidate tokens to maintain consistent shape.
             // Avoid shape checking and increasing the amount of computation when the shape changes.
@@ -0,0 +1,146 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Incremental index of the n-grams of a token sequence, used by prompt lookup to find a continuation of the
+ * last tokens. The index is updated only with appended tokens: each n-gram is hashed once, when the token following it
+ * is appended, so that every indexed n-gram has a continuation. A lookup hashes the last n-grams of the sequence and
+ * verifies the found occurrences token by token, so it takes O(max_ngram_size^2) regardless of the sequence length.
+ */
+class NGramIndex {
+public:
+    enum class MatchPolicy {
+        FIRST,        // the earliest occurrence of an n-gram is used
+        MOST_RECENT   // the latest occurrence of an n-gram is used
+    };
+
+private:
+    struct Occurrences {
+        // positions right after the earliest and the latest occurrences of an n-gram
+        size_t first;
+        size_t last;
+    };
+
+    size_t m_max_ngram_size;
+    MatchPolicy m_policy;
+    std::vector<int64_t> m_tokens;
+    // n-gram hash -> occurrences, one map per n-gram size
+    std::vector<std::unordered_map<uint64_t, Occurrences>> m_ngrams;
+
+    // hashes of n-grams ending at the same position are computed from the end, extending the shorter n-grams
+    static uint64_t _extend_hash(uint64_t hash, int64_t token) {
+        hash = (hash ^ static_cast<uint64_t>(token)) * 0x9E3779B97F4A7C15ull;
+        return hash ^ (hash >> 32);
+    }
+
+    void _index_ngrams_ending_at(size_t end) {
+        uint64_t hash = 0;
+        for (size_t ngram_size = 1; ngram_size <= std::min(m_max_ngram_size, end); ++ngram_size) {
+            hash = _extend_hash(hash, m_tokens[end - ngram_size]);
+            auto [it, is_inserted] = m_ngrams[ngram_size - 1].try_emplace(hash, Occurrences{end, end});
+            if (!is_inserted && std::equal(m_tokens.begin() + (end - ngram_size), m_tokens.begin() + end,
+                                           m_tokens.begin() + (it->second.last - ngram_size))) {
+                // on a hash collision the occurrences of the n-gram which has been indexed first are kept
+                it->second.last = end;
+            }
+        }
+    }
+
+    void _append(std::vector<int64_t>::const_iterator begin, std::vector<int64_t>::const_iterator end) {
+        m_tokens.reserve(m_tokens.size() + (end - begin));
+        for (auto it = begin; it != end; ++it) {
+            m_tokens.push_back(*it);
+            // n-grams which end right before the new token now have a continuation
+            _index_ngrams_ending_at(m_tokens.size() - 1);
+        }
+    }
+
+public:
+    /**
+     * @param max_ngram_size Maximum size of the n-grams to be looked up.
+     * @param policy Which occurrence of a matched n-gram provides the continuation.
+     */
+    explicit NGramIndex(size_t max_ngram_size, MatchPolicy policy = MatchPolicy::FIRST) :
+        m_max_ngram_size(max_ngram_size),
+        m_policy(policy),
+        m_ngrams(max_ngram_size) {}
+
+    /**
+     * Brings the index in sync with the sequence. Only the tokens generated since the previous call are indexed, unless
+     * the already indexed generated tokens have changed, in which case the whole sequence is reindexed.
+     * @param prompt_ids Prompt of the sequence, must be the same at each call.
+     * @param generated_ids Tokens generated by the sequence.
+     */
+    void update(const std::vector<int64_t>& prompt_ids, const std::vector<int64_t>& generated_ids) {
+        size_t num_common_tokens = 0;
+        if (m_tokens.size() >= prompt_ids.size()) {
+            auto mismatch = std::mismatch(m_tokens.begin() + prompt_ids.size(), m_tokens.end(), generated_ids.begin(), generated_ids.end());
+            num_common_tokens = mismatch.first - m_tokens.begin();
+        }
+        if (num_common_tokens < m_tokens.size() || m_tokens.empty()) {
+            // generated tokens have been removed or replaced, which does not happen in regular generation
+            m_tokens.clear();
+            for (auto& ngrams : m_ngrams) {
+                ngrams.clear();
+            }
+            _append(prompt_ids.begin(), prompt_ids.end());
+            num_common_tokens = prompt_ids.size();
+        }
+        _append(generated_ids.begin() + (num_common_tokens - prompt_ids.size()), generated_ids.end());
+    }
+
+    /**
+     * Finds the longest n-gram, which ends the sequence and occurs earlier in it, and returns the tokens following
+     * its occurrence chosen by the match policy.
+     * @param max_num_tokens Maximum number of tokens to be returned.
+     * @return The continuation, empty if the last token of the sequence has never occurred before.
+     */
+    std::vector<int64_t> find_continuation(size_t max_num_tokens) const {
+        const size_t length = m_tokens.size();
+        if (max_num_tokens == 0 || length == 0) {
+            return {};
+        }
+        // comparing the whole sequence is not meaningful until the n-gram size reaches half of its length,
+        // because the n-grams would overlap with it
+        const size_t max_ngram_size = m_max_ngram_size >= length ? length / 2 : m_max_ngram_size;
+
+        std::vector<uint64_t> hashes(max_ngram_size);
+        uint64_t hash = 0;
+        for (size_t ngram_size = 1; ngram_size <= max_ngram_size; ++ngram_size) {
+            hash = _extend_hash(hash, m_tokens[length - ngram_size]);
+            hashes[ngram_size - 1] = hash;
+        }
+
+        for (size_t ngram_size = max_ngram_size; ngram_size > 0; --ngram_size) {
+            auto it = m_ngrams[ngram_size - 1].find(hashes[ngram_size - 1]);
+            if (it == m_ngrams[ngram_size - 1].end()) {
+                continue;
+            }
+            size_t continuation_begin = m_policy == MatchPolicy::FIRST ? it->second.first : it->second.last;
+            if (!std::equal(m_tokens.end() - ngram_size, m_tokens.end(), m_tokens.begin() + (continuation_begin - ngram_size))) {
+                continue;
+            }
+            size_t continuation_end = std::min(length, continuation_begin + max_num_tokens);
+            return {m_tokens.begin() + continuation_begin, m_tokens.begin() + continuation_end};
+        }
+        return {};
+    }
+
+    /**
+     * @return Number of indexed tokens.
+     */
+    size_t size() const {
+        return m_tokens.size();
+    }
+};
+
+}  // namespace ov::genai
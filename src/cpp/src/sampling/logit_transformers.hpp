@@ -7,6 +7,7 @@
 #include <cmath>
 
 #include "openvino/genai/generation_config.hpp"
+#include "sampling/sampling_kernels.hpp"
 
 namespace ov::genai {
 
@@ -73,46 +74,12 @@ class TopPFilter : public ILogitTransformer {
 public:
     TopPFilter(double top_p) : m_top_p(top_p) {}
 
-    bool partial_sort_and_resize(Logits& logits) {
-        // Since most of the time huge part of logits vector contains minimal values
-        // expensive sorting of entire vector might be unnecessary, especially for low values of top_p.
-        // This method partially sorts vector finding M top elements and stops when top_p condition is met.
-        // It iterates a few times starting with M = 16 and multiplying it by 2 each iteration until M = 1024.
-        // If top_p is found in considered scope it resizes logits vector and returns true. Otherwise it returns false.
-        // Note that it can we less performant than standard approach if logits value are more evenly distributed across the vector.
-        for (size_t step = 16; step <= 1024; step *= 2) {
-            if (logits.m_vector.size() <= step)
-                break;
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + step, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-            float sum = 0.0;
-            for (int i = 0; i < step; i++) {
-                sum += logits.m_vector[i].m_log_prob;
-                if (sum > m_top_p) {
-                    logits.resize(i+1);
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-
-    void full_sort_and_resize(Logits& logits) {
-        std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-        float probability_sum = 0.0f;
-        size_t nucleus_size = 0;
-        for (const auto& logit : logits.m_vector) {
-            probability_sum += logit.m_log_prob;
-            nucleus_size += 1;
-            if (probability_sum > m_top_p) break;
-        }
-        logits.resize(nucleus_size);
-    }
-
     void apply(Logits& logits) override {
-        // Initialize and sort vector. Try partial sorting first and if it's not enough, sort entire vector.
-        logits.initialize_vector();
-        if(!partial_sort_and_resize(logits))
-            full_sort_and_resize(logits);
+        // Only the largest probabilities which may belong to the nucleus are collected and sorted,
+        // instead of sorting the entire vocabulary.
+        OPENVINO_ASSERT(!logits.is_vector_initialized(), "Logits vector already initialized");
+        SamplingKernels::select_top_p(logits.m_data, logits.m_size, m_top_p, logits.m_vector);
+        logits.m_size = logits.m_vector.size();
     }
 
 protected:
@@ -123,7 +90,7 @@ class TopKFilter : public ILogitTransformer {
 public:
     TopKFilter(size_t top_k) : m_top_k(top_k) {}
 
-    // If this transform is used along with top_p, it should be applied after it since top_p sorts entire vector and top_k does it only partially
+    // If this transform is used along with top_p, it should be applied after it since top_p sorts the selected vector
     void apply(Logits& logits) override {
 
         if (m_top_k >= logits.m_size)
@@ -131,9 +98,7 @@ public:
 
         // If top_p is also used vector is already initialized and sorted
         if (!logits.is_vector_initialized()) {
-            // Initialize and partially sort vector
-            logits.initialize_vector();
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+            SamplingKernels::select_top_k(logits.m_data, logits.m_size, m_top_k, logits.m_vector);
         }
         logits.resize(m_top_k);
     }
@@ -147,22 +112,7 @@ public:
     TemperatureLogitTransform(double temperature) : m_temperature(temperature) {};
 
     void apply(Logits& logits) override {
-        float max_logit = -std::numeric_limits<float>::infinity();
-        for (size_t i = 0; i < logits.m_size; i++) {
-            if (logits.m_data[i] > max_logit) {
-                max_logit = logits.m_data[i];
-            }
-        }
-
-        float norm_sum = 0.0;
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] = expf((logits.m_data[i] - max_logit) / this->m_temperature);
-            norm_sum += logits.m_data[i];
-        }
-
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] /= norm_sum;
-        }
+        SamplingKernels::softmax_with_temperature(logits.m_data, logits.m_size, m_temperature);
     }
 
 protected:
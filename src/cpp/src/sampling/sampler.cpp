@@ -98,27 +98,16 @@ std::vector<int64_t> encode_and_process_string(const std::string& stop_string, o
     return encoded_stop_string;
 }
 
-struct MatchStopStringResult {
-    size_t to_remove = 0;
-    // int64_t last_token_id = 0;
-    // bool is_to_update_last_token = false;
-    bool is_matched = false;
-};
-
 // Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
+// Used by beam search, whose candidates are checked before they are appended to sequences, so the incremental
+// StopStringMatcher state cannot be kept per sequence.
 MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
                       const TokenIds& generated_tokens,
                       const std::pair<size_t, std::set<std::string>>& stop_strings,
-                      bool is_include_to_output,
-                      size_t draft_generated_tokens = 0) {
+                      bool is_include_to_output) {
     MatchStopStringResult result;
     if (generated_tokens.size() >= stop_strings.first) {
-        // draft_generated_tokens is to handle case with >= 1 generated tokens per step
-        size_t offset = generated_tokens.size() - draft_generated_tokens;
-        if (offset < stop_strings.first) {
-            return result;
-        }
-        offset -= stop_strings.first;
+        size_t offset = generated_tokens.size() - stop_strings.first;
         TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
         std::string decoded_buffer = tokenizer.decode(buffer);
         for (const auto& stop_string : stop_strings.second) {
@@ -153,36 +142,6 @@ MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
     return result;
 }
 
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-// Number of tokens might not be exact as if there's no direct token match, we decode generated tokens incrementally expanding decoding scope
-// with 4 next tokens with each iteration until we check all tokens.
-int match_stop_string2(Tokenizer & tokenizer, const TokenIds & generated_tokens, const std::set<std::string> & stop_strings) {
-    for (const auto& stop_string: stop_strings) {
-        auto stop_tokens_ov = tokenizer.encode(stop_string).input_ids;
-        size_t num_tokens = stop_tokens_ov.get_size();
-        if(num_tokens > generated_tokens.size())
-            continue;
-
-        // Check direct token match
-        std::vector<int64_t> stop_tokens(stop_tokens_ov.data<int64_t>(), stop_tokens_ov.data<int64_t>() + num_tokens);
-        std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-        if (stop_tokens == last_generated_tokens)
-            return num_tokens;
-        
-        // Continue checking chunks of 4 tokens
-        num_tokens += 4;
-        while (num_tokens <= generated_tokens.size()) {
-            std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-            std::string decoded_last_tokens = tokenizer.decode(last_generated_tokens);
-            if (decoded_last_tokens.find(stop_string) != std::string::npos) {
-                return num_tokens;
-            }
-            num_tokens += 4;
-        }
-    }
-    return 0;
-}
-
 void Sampler::GroupBeamSearcher::finalize(SamplerOutput& sampler_output) {
     for (Group& group : m_groups) {
         if (!group.done) {
@@ -492,6 +451,25 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     }
 }
 
+namespace {
+// Lends the capacity of a per-thread buffer to the token vector of Logits for the lifetime of the lease,
+// so that top-k / top-p filters do not allocate memory for each sampled token.
+class TokenBufferLease {
+    Logits& m_logits;
+    std::vector<Token>& m_buffer;
+public:
+    TokenBufferLease(Logits& logits, std::vector<Token>& buffer) : m_logits(logits), m_buffer(buffer) {
+        m_buffer.clear();
+        m_logits.m_vector.swap(m_buffer);
+    }
+
+    ~TokenBufferLease() {
+        m_logits.m_vector.swap(m_buffer);
+        m_buffer.clear();
+    }
+};
+}  // namespace
+
 Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx) {
     ov::Shape logits_shape = logits.get_shape();
     size_t batch_size = logits_shape[0], seq_len = logits_shape[1], vocab_size = logits_shape[2];
@@ -540,29 +518,36 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
 }
 
 std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
-    // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
-    std::vector<float> multinomial_weights;
-    multinomial_weights.reserve(logits.m_size);
-    if (logits.is_vector_initialized())
-        for (auto& logit: logits.m_vector) multinomial_weights.emplace_back(logit.m_log_prob);
-    else
-        multinomial_weights.assign(logits.m_data, logits.m_data + logits.m_size);
-
-    // std::discrete_distribution returns corrupted results when applied to log probabilities
-    // which result returning NAN only logprobs.
-    // so log() is applied after this line
-    auto dist = std::discrete_distribution<size_t>(multinomial_weights.begin(), multinomial_weights.end()); // equivalent to multinomial with number of trials == 1
-
+    // If top_p or top_k was applied we use the selected tokens, if not we go with original buffer.
+    // Weights are not normalized, so tokens are picked by inverse CDF lookup of a uniform point in [0, sum of weights),
+    // log() is applied to the picked weights only.
     std::vector<Token> out_tokens;
-    for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
-        size_t element_to_pick = dist(rng_engine);
-        if (logits.is_vector_initialized()) {
+    out_tokens.reserve(num_tokens_per_sequence);
+    if (logits.is_vector_initialized()) {
+        float weights_sum = 0.0f;
+        for (const auto& logit : logits.m_vector)
+            weights_sum += logit.m_log_prob;
+        auto dist = std::uniform_real_distribution<float>(0.0f, weights_sum);
+        for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
+            float threshold = dist(rng_engine), running_sum = 0.0f;
+            size_t element_to_pick = logits.m_vector.size() - 1;
+            for (size_t i = 0; i < logits.m_vector.size(); ++i) {
+                running_sum += logits.m_vector[i].m_log_prob;
+                if (running_sum > threshold) {
+                    element_to_pick = i;
+                    break;
+                }
+            }
             auto logit = logits.m_vector[element_to_pick];
             logit.m_log_prob = std::log(logit.m_log_prob);
             out_tokens.push_back(logit);
         }
-        else
+    } else {
+        auto dist = std::uniform_real_distribution<float>(0.0f, SamplingKernels::sum(logits.m_data, logits.m_size));
+        for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
+            size_t element_to_pick = SamplingKernels::find_inverse_cdf(logits.m_data, logits.m_size, dist(rng_engine));
             out_tokens.emplace_back(std::log(logits.m_data[element_to_pick]), element_to_pick);
+        }
     }
     return out_tokens;
 }
@@ -588,11 +573,15 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
         }
 
         if (!sampling_params.stop_strings.empty()) {
-            auto& stop_strings = m_stop_strings.at(sequence_group->get_request_id());
-            auto match_result = match_stop_string(m_tokenizer, running_sequence->get_generated_ids(), stop_strings,
-                                                  sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
+            auto& stop_string_matcher = m_stop_string_matchers.at(sequence_group->get_request_id());
+            auto decode = [this](TokenIds::const_iterator begin, TokenIds::const_iterator end) {
+                return m_tokenizer.decode(TokenIds(begin, end));
+            };
+            auto match_result = stop_string_matcher.match(running_sequence->get_id(), running_sequence->get_generated_ids(),
+                                                          sampling_params.include_stop_str_in_output, decode);
             if (match_result.is_matched) {
                 running_sequence->remove_last_tokens(match_result.to_remove);
+                stop_string_matcher.release(running_sequence->get_id());
 
                 running_sequence->set_status(SequenceStatus::FINISHED);
                 running_sequence->set_finish_reason(GenerationFinishReason::STOP);
@@ -771,7 +760,7 @@ process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& token
 
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
                                                               LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
-                                                              bool is_validation_mode_enabled) {
+                                                              bool is_validation_mode_enabled, std::vector<Token>& token_buffer) {
     SequenceGroupSamplingInfo sg_sampling_info;
     // Assistant pipeline info is relevant for speculative and prompt lookup decoding
     AssistingPipelineInfo& assisting_pipeline_info = sg_sampling_info.get_assisting_pipeline_info();
@@ -821,6 +810,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 }
 
                 auto logit_vector = _get_logit_vector(sequence_group_logits, running_sequence_id, logit_token_offset);
+                TokenBufferLease token_buffer_lease(logit_vector, token_buffer);
                 logit_processor.apply(logit_vector);
                 
                 Token sampled_token;
@@ -937,8 +927,17 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
     OPENVINO_ASSERT(logits_shape.size() == 3);
     size_t vocab_size = logits_shape[2];
 
+    struct SamplingTask {
+        SequenceGroup::Ptr sequence_group;
+        ov::Tensor sequence_group_logits;
+        LogitProcessor* logit_processor;
+        const std::pair<size_t, std::set<std::string>>* stop_strings;
+    };
+    std::vector<SamplingTask> sampling_tasks;
+    // request_id => index in sampling_tasks
+    std::unordered_map<uint64_t, size_t> sampling_task_ids;
+
     SamplerOutput sampler_output;
-    std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -961,6 +960,7 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
                 OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
                 auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
                 m_stop_strings.insert({static_cast<int64_t>(request_id), processed_stop_string});
+                m_stop_string_matchers.emplace(request_id, StopStringMatcher(processed_stop_string.second));
                 sequence_group->set_stream_window_size(processed_stop_string.first);
             } else {
                 m_stop_strings.insert({static_cast<int64_t>(request_id), {size_t(0), {}}});
@@ -971,9 +971,8 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
         if (sequence_group->requires_sampling()) {
-            // Call sample_from_sequence_group asynchronously
-            sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+            sampling_task_ids[request_id] = sampling_tasks.size();
+            sampling_tasks.push_back({sequence_group, sequence_group_logits, &logit_processor, &stop_strings});
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -981,15 +980,23 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         currently_processed_tokens += output_seq_len * num_running_sequences;
     }
 
+    // Sample all sequence groups in a single pass over the logits, split between the pool threads and the current thread
+    std::vector<SequenceGroupSamplingInfo> sampling_infos(sampling_tasks.size());
+    m_thread_pool.parallel_for(sampling_tasks.size(), [&](size_t task_idx, size_t worker_idx) {
+        const SamplingTask& task = sampling_tasks[task_idx];
+        sampling_infos[task_idx] = sample_from_sequence_group(task.sequence_group, task.sequence_group_logits, *task.logit_processor,
+                                                              *task.stop_strings, is_validation_mode_enabled, m_token_buffers[worker_idx]);
+    });
+
     // Update sequence groups internal states after sampling is done
     for (auto& sequence_group : sequence_groups) {
         if (!sequence_group->is_scheduled())
             continue;
         SequenceGroupSamplingInfo sg_sampling_info;
         const auto request_id = sequence_group->get_request_id();
-        if (sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end()) {
-            // If there is a future assigned to a sequence group we read it's result (blocking if results not available yet)
-            sg_sampling_info = sg_sampling_future_map[request_id].get();
+        auto task_it = sampling_task_ids.find(request_id);
+        if (task_it != sampling_task_ids.end()) {
+            sg_sampling_info = std::move(sampling_infos[task_it->second]);
             sampler_output.num_generated_tokens += sg_sampling_info.sampler_output.num_generated_tokens;
 
             // Merge sampler output from sequence group to the main one
@@ -1043,6 +1050,7 @@ void Sampler::clear_request_info(uint64_t request_id) {
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
     m_stop_strings.erase(request_id);
+    m_stop_string_matchers.erase(request_id);
 }
 
 int64_t Sampler::GroupBeamSearcher::Group::finish(Beam beam, const ov::genai::GenerationConfig& sampling_params) {
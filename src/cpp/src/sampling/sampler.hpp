@@ -18,6 +18,7 @@
 
 #include "sampling/logit_transformers.hpp"
 #include "sampling/logit_processor.hpp"
+#include "sampling/stop_string_matcher.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "sequence_group.hpp"
 #include "threadpool.hpp"
@@ -83,7 +84,7 @@ class Sampler {
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
                                                         LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
-                                                        bool is_validation_mode_enabled);
+                                                        bool is_validation_mode_enabled, std::vector<Token>& token_buffer);
 
     // request ID => beam search tracking information
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
@@ -95,16 +96,20 @@ class Sampler {
     std::map<uint64_t, LogitProcessor> m_logit_processors;
     // { request_id, { max_encoded_len, { stop_strings }}}
     std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // { request_id, incremental stop string matcher }, used when tokens are sampled independently per sequence
+    std::map<uint64_t, StopStringMatcher> m_stop_string_matchers;
 
     Tokenizer m_tokenizer;
 
     ThreadPool m_thread_pool;
+    // per-thread buffers for the tokens selected by top-k / top-p filters, indexed by ThreadPool::parallel_for worker index
+    std::vector<std::vector<Token>> m_token_buffers;
     std::shared_ptr<ov::op::v0::Constant> m_d2t_mapping; // Tensor to store draft_id_to_target_id mapping for eagle model, adding offsets to draft tokens after sampling
 public:
     Sampler(const Sampler& rhs) = delete;
     Sampler(Sampler&& rhs) = delete;
-    Sampler(size_t num_threads = 1): m_thread_pool(num_threads) {};
-    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
+    Sampler(size_t num_threads = 1): m_thread_pool(num_threads), m_token_buffers(num_threads + 1) {};
+    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads), m_token_buffers(num_threads + 1) {};
 
     SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
     void set_seed(size_t new_seed) {
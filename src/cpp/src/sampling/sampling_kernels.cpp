@@ -0,0 +1,265 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampling/sampling_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#ifdef __AVX2__
+#    include <immintrin.h>
+#endif
+
+#include "sampling/logit_transformers.hpp"
+
+namespace ov::genai::SamplingKernels {
+
+namespace {
+
+// values are bucketed by the 11 highest bits of their order-preserving keys: sign, exponent and 2 bits of mantissa
+constexpr uint32_t BUCKET_SHIFT = 21;
+constexpr size_t NUM_BUCKETS = size_t(1) << (32 - BUCKET_SHIFT);
+
+// maps floats to unsigned integers, so that the order of the integers is the order of the floats
+inline uint32_t to_ordered_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline float from_ordered_key(uint32_t key) {
+    uint32_t bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// the smallest value which falls into a given bucket
+inline float get_bucket_lower_bound(size_t bucket) {
+    // the key 0 of the first bucket maps to NaN, which does not compare with anything
+    if (bucket == 0) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    return from_ordered_key(static_cast<uint32_t>(bucket << BUCKET_SHIFT));
+}
+
+bool greater_log_prob(const Token& lhs, const Token& rhs) {
+    return lhs.m_log_prob > rhs.m_log_prob;
+}
+
+#ifdef __AVX2__
+inline float horizontal_sum(__m256 values) {
+    __m128 sums = _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+    sums = _mm_add_ps(sums, _mm_movehl_ps(sums, sums));
+    sums = _mm_add_ss(sums, _mm_movehdup_ps(sums));
+    return _mm_cvtss_f32(sums);
+}
+
+inline float horizontal_max(__m256 values) {
+    __m128 maxs = _mm_max_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+    maxs = _mm_max_ps(maxs, _mm_movehl_ps(maxs, maxs));
+    maxs = _mm_max_ss(maxs, _mm_movehdup_ps(maxs));
+    return _mm_cvtss_f32(maxs);
+}
+
+// exp(x) with the Cephes polynomial approximation, the relative error is below 2e-7 in the whole float range
+inline __m256 exp_ps(__m256 x) {
+    x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+    x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+    // exp(x) = 2^n * exp(r), where n = round(x / ln(2)) and r = x - n * ln(2)
+    __m256 n = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)), _mm256_set1_ps(0.5f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(0.693359375f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(-2.12194440e-4f)));
+
+    __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.3981999507e-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(8.3334519073e-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(4.1665795894e-2f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.6666665459e-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(5.0000001201e-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, _mm256_mul_ps(x, x)), _mm256_add_ps(x, _mm256_set1_ps(1.0f)));
+
+    __m256i pow2n = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+#endif
+
+float max_value(const float* data, size_t size) {
+    float max_logit = -std::numeric_limits<float>::infinity();
+    size_t i = 0;
+#ifdef __AVX2__
+    __m256 max_vec = _mm256_set1_ps(max_logit);
+    for (; i + 8 <= size; i += 8) {
+        max_vec = _mm256_max_ps(max_vec, _mm256_loadu_ps(data + i));
+    }
+    max_logit = horizontal_max(max_vec);
+#endif
+    for (; i < size; ++i) {
+        max_logit = std::max(max_logit, data[i]);
+    }
+    return max_logit;
+}
+
+// collects all values which are not less than `lower_bound`
+void collect_not_less(const float* data, size_t size, float lower_bound, std::vector<Token>& tokens) {
+    tokens.clear();
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256 lower_bound_vec = _mm256_set1_ps(lower_bound);
+    for (; i + 8 <= size; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), lower_bound_vec, _CMP_GE_OQ));
+        for (size_t lane = i; mask != 0; ++lane, mask >>= 1) {
+            if (mask & 1) {
+                tokens.emplace_back(data[lane], lane);
+            }
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        if (data[i] >= lower_bound) {
+            tokens.emplace_back(data[i], i);
+        }
+    }
+}
+
+}  // namespace
+
+void softmax_with_temperature(float* data, size_t size, float temperature) {
+    const float max_logit = max_value(data, size);
+    float norm_sum = 0.0f;
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256 max_vec = _mm256_set1_ps(max_logit);
+    const __m256 inv_temperature_vec = _mm256_set1_ps(1.0f / temperature);
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8) {
+        __m256 values = exp_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(data + i), max_vec), inv_temperature_vec));
+        _mm256_storeu_ps(data + i, values);
+        sum_vec = _mm256_add_ps(sum_vec, values);
+    }
+    norm_sum = horizontal_sum(sum_vec);
+#endif
+    for (; i < size; ++i) {
+        data[i] = expf((data[i] - max_logit) / temperature);
+        norm_sum += data[i];
+    }
+
+    i = 0;
+#ifdef __AVX2__
+    const __m256 inv_sum_vec = _mm256_set1_ps(1.0f / norm_sum);
+    for (; i + 8 <= size; i += 8) {
+        _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), inv_sum_vec));
+    }
+#endif
+    for (; i < size; ++i) {
+        data[i] /= norm_sum;
+    }
+}
+
+void select_top_k(const float* data, size_t size, size_t top_k, std::vector<Token>& tokens) {
+    std::array<uint32_t, NUM_BUCKETS> counts{};
+    for (size_t i = 0; i < size; ++i) {
+        ++counts[to_ordered_key(data[i]) >> BUCKET_SHIFT];
+    }
+
+    // the bucket with the k-th largest value
+    size_t bucket = NUM_BUCKETS, num_candidates = 0;
+    while (num_candidates < top_k && bucket > 0) {
+        num_candidates += counts[--bucket];
+    }
+
+    tokens.reserve(num_candidates);
+    collect_not_less(data, size, get_bucket_lower_bound(bucket), tokens);
+    top_k = std::min(top_k, tokens.size());
+    std::partial_sort(tokens.begin(), tokens.begin() + top_k, tokens.end(), greater_log_prob);
+    tokens.resize(top_k);
+}
+
+void select_top_p(const float* probs, size_t size, double top_p, std::vector<Token>& tokens) {
+    std::array<float, NUM_BUCKETS> masses{};
+    for (size_t i = 0; i < size; ++i) {
+        masses[to_ordered_key(probs[i]) >> BUCKET_SHIFT] += probs[i];
+    }
+
+    // the bucket in which the running sum of the largest probabilities exceeds top_p
+    size_t bucket = NUM_BUCKETS;
+    float probability_sum = 0.0f;
+    while (bucket > 0) {
+        probability_sum += masses[--bucket];
+        if (probability_sum > top_p) {
+            break;
+        }
+    }
+
+    while (true) {
+        collect_not_less(probs, size, get_bucket_lower_bound(bucket), tokens);
+        std::sort(tokens.begin(), tokens.end(), greater_log_prob);
+        probability_sum = 0.0f;
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            probability_sum += tokens[i].m_log_prob;
+            if (probability_sum > top_p) {
+                tokens.resize(i + 1);
+                return;
+            }
+        }
+        if (bucket == 0) {
+            // the whole vocabulary is in the nucleus
+            return;
+        }
+        // the running sum is accumulated in a different order than the bucket masses, so rounding may require
+        // including the next non-empty bucket
+        do {
+            --bucket;
+        } while (bucket > 0 && masses[bucket] == 0.0f);
+    }
+}
+
+float sum(const float* data, size_t size) {
+    float total = 0.0f;
+    size_t i = 0;
+#ifdef __AVX2__
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8) {
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_loadu_ps(data + i));
+    }
+    total = horizontal_sum(sum_vec);
+#endif
+    for (; i < size; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+size_t find_inverse_cdf(const float* weights, size_t size, float threshold) {
+    float running_sum = 0.0f;
+    size_t i = 0;
+#ifdef __AVX2__
+    // skip whole blocks of weights until the block in which the running sum exceeds the threshold
+    for (; i + 8 <= size; i += 8) {
+        float block_sum = horizontal_sum(_mm256_loadu_ps(weights + i));
+        if (running_sum + block_sum > threshold) {
+            break;
+        }
+        running_sum += block_sum;
+    }
+#endif
+    for (; i < size; ++i) {
+        running_sum += weights[i];
+        if (running_sum > threshold) {
+            return i;
+        }
+    }
+    for (size_t last = size; last > 0; --last) {
+        if (weights[last - 1] > 0.0f) {
+            return last - 1;
+        }
+    }
+    return 0;
+}
+
+}  // namespace ov::genai::SamplingKernels
@@ -0,0 +1,65 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov::genai {
+
+struct Token;
+
+/**
+ * @brief Kernels for the logit transformations and the sampling on whole vocabularies.
+ * Kernels use AVX2 when the library is compiled with it and fall back to scalar code otherwise. Selection kernels
+ * avoid sorting the whole vocabulary: values are first bucketed by the high bits of their order-preserving integer
+ * representation, and only the values in the buckets which may belong to the result are collected and sorted.
+ */
+namespace SamplingKernels {
+
+/**
+ * Replaces the values with softmax(values / temperature).
+ * @param data The values to be transformed in-place.
+ * @param size Number of values.
+ * @param temperature The temperature.
+ */
+void softmax_with_temperature(float* data, size_t size, float temperature);
+
+/**
+ * Selects `top_k` largest values.
+ * @param data The values.
+ * @param size Number of values.
+ * @param top_k Number of values to be selected, must be less than `size`.
+ * @param[out] tokens Selected values and their indices in descending order of values.
+ */
+void select_top_k(const float* data, size_t size, size_t top_k, std::vector<Token>& tokens);
+
+/**
+ * Selects the smallest set of largest probabilities whose sum exceeds `top_p`.
+ * @param probs The probabilities.
+ * @param size Number of probabilities.
+ * @param top_p The threshold for the sum of the selected probabilities.
+ * @param[out] tokens Selected probabilities and their indices in descending order of probabilities.
+ */
+void select_top_p(const float* probs, size_t size, double top_p, std::vector<Token>& tokens);
+
+/**
+ * @param data The values.
+ * @param size Number of values.
+ * @return Sum of the values.
+ */
+float sum(const float* data, size_t size);
+
+/**
+ * Inverse CDF lookup for sampling from a discrete distribution given by non-normalized weights.
+ * @param weights The weights.
+ * @param size Number of weights.
+ * @param threshold A point in [0, sum of weights).
+ * @return Index of the first weight at which the running sum of weights exceeds `threshold`.
+ * The last non-zero weight is returned if `threshold` is not exceeded due to rounding.
+ */
+size_t find_inverse_cdf(const float* weights, size_t size, float threshold);
+
+}  // namespace SamplingKernels
+}  // namespace ov::genai
@@ -0,0 +1,343 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+struct MatchStopStringResult {
+    size_t to_remove = 0;
+    bool is_matched = false;
+};
+
+/**
+ * @brief Aho-Corasick automaton over the bytes of a set of stop strings. Feeding the automaton one byte at a time finds
+ * all occurrences of all stop strings in a single pass over a text, without restarting the search at each position.
+ */
+class StopStringAutomaton {
+    struct Node {
+        // (byte, child node) pairs, there are few of them per node, so they are searched linearly
+        std::vector<std::pair<uint8_t, uint32_t>> children;
+        uint32_t fail = 0;
+        // length of the longest stop string which is a suffix of the text leading to this node, 0 if there is none
+        size_t match_length = 0;
+    };
+
+    std::vector<Node> m_nodes;
+    size_t m_max_length = 0;
+
+    int64_t _get_child(uint32_t state, uint8_t byte) const {
+        for (const auto& [child_byte, child] : m_nodes[state].children) {
+            if (child_byte == byte) {
+                return child;
+            }
+        }
+        return -1;
+    }
+
+public:
+    using State = uint32_t;
+    static constexpr State INITIAL_STATE = 0;
+
+    explicit StopStringAutomaton(const std::set<std::string>& stop_strings) : m_nodes(1) {
+        for (const auto& stop_string : stop_strings) {
+            OPENVINO_ASSERT(!stop_string.empty(), "Stop strings must not be empty");
+            uint32_t state = INITIAL_STATE;
+            for (char c : stop_string) {
+                uint8_t byte = static_cast<uint8_t>(c);
+                int64_t child = _get_child(state, byte);
+                if (child < 0) {
+                    child = static_cast<int64_t>(m_nodes.size());
+                    m_nodes[state].children.emplace_back(byte, static_cast<uint32_t>(child));
+                    m_nodes.emplace_back();
+                }
+                state = static_cast<uint32_t>(child);
+            }
+            m_nodes[state].match_length = stop_string.size();
+            m_max_length = std::max(m_max_length, stop_string.size());
+        }
+
+        // failure links are computed in breadth-first order, so that the links of shorter prefixes are ready
+        std::vector<uint32_t> queue;
+        queue.reserve(m_nodes.size());
+        for (const auto& [byte, child] : m_nodes[INITIAL_STATE].children) {
+            queue.push_back(child);
+        }
+        for (size_t i = 0; i < queue.size(); ++i) {
+            uint32_t node = queue[i];
+            for (const auto& [byte, child] : m_nodes[node].children) {
+                m_nodes[child].fail = next(m_nodes[node].fail, byte);
+                m_nodes[child].match_length = std::max(m_nodes[child].match_length, m_nodes[m_nodes[child].fail].match_length);
+                queue.push_back(child);
+            }
+        }
+    }
+
+    /**
+     * @param state Current state.
+     * @param byte Next byte of the text.
+     * @return State after the byte.
+     */
+    State next(State state, uint8_t byte) const {
+        while (true) {
+            int64_t child = _get_child(state, byte);
+            if (child >= 0) {
+                return static_cast<State>(child);
+            }
+            if (state == INITIAL_STATE) {
+                return INITIAL_STATE;
+            }
+            state = m_nodes[state].fail;
+        }
+    }
+
+    /**
+     * @param state Current state.
+     * @return Length of the longest stop string ending at the last fed byte, 0 if no stop string ends there.
+     */
+    size_t get_match_length(State state) const {
+        return m_nodes[state].match_length;
+    }
+
+    /**
+     * @return Length of the longest stop string in bytes.
+     */
+    size_t get_max_length() const {
+        return m_max_length;
+    }
+};
+
+/**
+ * @brief Matches stop strings in the text generated by a single sequence. Generated tokens are detokenized incrementally:
+ * only a short window of the latest tokens is decoded once per step, and only the text added by new tokens is fed to
+ * the automaton. Positions at which the text of each step ends are recorded, so that tokens removed from the sequence,
+ * e.g. rejected speculative tokens, are rolled back without decoding again. The text of tokens added in the same step
+ * is only split between them when a stop string is matched there.
+ */
+class IncrementalStopStringMatcher {
+    // the decoding window is shrunk to the last WINDOW_CONTEXT tokens once it grows beyond MAX_WINDOW tokens;
+    // the context keeps the decoding of the first new token the same as if the whole sequence was decoded
+    static constexpr size_t MAX_WINDOW = 16;
+    static constexpr size_t WINDOW_CONTEXT = 4;
+    // new tokens whose text ends with an incomplete UTF-8 character are held back until the character is completed by
+    // later tokens, but no more than this number of tokens
+    static constexpr size_t MAX_PENDING_TOKENS = 4;
+
+    std::shared_ptr<const StopStringAutomaton> m_automaton;
+    StopStringAutomaton::State m_state = StopStringAutomaton::INITIAL_STATE;
+
+    // tokens whose text has been fed to the automaton
+    std::vector<int64_t> m_tokens;
+    std::string m_text;
+    // (number of tokens, length of m_text) after each step which fed new tokens to the automaton
+    std::vector<std::pair<size_t, size_t>> m_step_ends;
+
+    // first token of the decoding window and the text of m_tokens[m_window_begin:] within the window. The end of the
+    // window text is always the same as the end of m_text
+    size_t m_window_begin = 0;
+    std::string m_window_text;
+    bool m_is_window_text_valid = true;
+
+    static bool _ends_with_replacement_character(const std::string& text) {
+        static const std::string replacement_character = "\xEF\xBF\xBD";
+        return text.size() >= replacement_character.size() &&
+               text.compare(text.size() - replacement_character.size(), replacement_character.size(), replacement_character) == 0;
+    }
+
+    void _rollback(size_t num_common_tokens) {
+        // the text is only known at step ends, tokens after the last one are fed again as new tokens
+        while (!m_step_ends.empty() && m_step_ends.back().first > num_common_tokens) {
+            m_step_ends.pop_back();
+        }
+        size_t num_tokens = m_step_ends.empty() ? 0 : m_step_ends.back().first;
+        size_t text_end = m_step_ends.empty() ? 0 : m_step_ends.back().second;
+        size_t num_removed_bytes = m_text.size() - text_end;
+        m_tokens.resize(num_tokens);
+        m_text.resize(text_end);
+        if (num_tokens > m_window_begin && num_removed_bytes <= m_window_text.size()) {
+            m_window_text.resize(m_window_text.size() - num_removed_bytes);
+        } else {
+            m_window_begin = num_tokens > WINDOW_CONTEXT ? num_tokens - WINDOW_CONTEXT : 0;
+            m_is_window_text_valid = false;
+        }
+
+        // the state depends only on the text suffix which may still become a stop string
+        m_state = StopStringAutomaton::INITIAL_STATE;
+        size_t suffix_length = std::min(m_text.size(), m_automaton->get_max_length());
+        for (size_t i = m_text.size() - suffix_length; i < m_text.size(); ++i) {
+            m_state = m_automaton->next(m_state, static_cast<uint8_t>(m_text[i]));
+        }
+    }
+
+    // position in the decoded window text where the text of the new tokens begins
+    template <typename DecodeFunction>
+    size_t _get_new_text_begin(const std::string& window_text, DecodeFunction&& decode) const {
+        if (window_text.compare(0, m_window_text.size(), m_window_text) == 0) {
+            return m_window_text.size();
+        }
+        // the window is shrunk without decoding its first token alone, which may drop its leading space
+        if (!m_window_text.empty() && m_window_text.front() == ' ' &&
+            window_text.compare(0, m_window_text.size() - 1, m_window_text, 1, std::string::npos) == 0) {
+            return m_window_text.size() - 1;
+        }
+        // the new tokens have changed the text of the previous ones, which are decoded alone
+        std::string known_text = decode(m_tokens.cbegin() + m_window_begin, m_tokens.cend());
+        return std::min(known_text.size(), window_text.size());
+    }
+
+    void _shrink_window() {
+        // the window begins at a step end, where the position of the text is known
+        for (auto it = m_step_ends.rbegin(); it != m_step_ends.rend(); ++it) {
+            if (it->first <= m_tokens.size() - WINDOW_CONTEXT) {
+                size_t num_kept_bytes = m_text.size() - it->second;
+                if (it->first > m_window_begin && num_kept_bytes <= m_window_text.size()) {
+                    m_window_text.erase(0, m_window_text.size() - num_kept_bytes);
+                    m_window_begin = it->first;
+                }
+                return;
+            }
+        }
+    }
+
+    template <typename DecodeFunction>
+    MatchStopStringResult _get_match_result(size_t match_end, size_t match_length, size_t num_generated_tokens, bool is_include_to_output,
+                                            DecodeFunction&& decode) const {
+        size_t kept_length = is_include_to_output ? match_end : match_end - match_length;
+        // to remove word splitting symbols from tail
+        while (kept_length > 0 && (m_text[kept_length - 1] == ' ' || m_text[kept_length - 1] == '\n')) {
+            --kept_length;
+        }
+        size_t num_kept_tokens = 0;
+        if (kept_length > 0) {
+            // the first step whose text reaches the end of the kept text
+            auto step_end = std::lower_bound(m_step_ends.begin(), m_step_ends.end(), kept_length,
+                                             [](const std::pair<size_t, size_t>& step, size_t length) { return step.second < length; });
+            num_kept_tokens = step_end->first;
+            size_t step_begin = step_end == m_step_ends.begin() ? 0 : std::prev(step_end)->first;
+            size_t step_text_begin = step_end == m_step_ends.begin() ? 0 : std::prev(step_end)->second;
+            if (num_kept_tokens - step_begin > 1) {
+                // the first token of the step whose text reaches the end of the kept text, tokens which end with an
+                // incomplete character do not reach further than the previous ones
+                auto context_begin = m_tokens.cbegin() + (step_begin > WINDOW_CONTEXT ? step_begin - WINDOW_CONTEXT : 0);
+                size_t context_length = context_begin == m_tokens.cbegin() + step_begin ? 0 : decode(context_begin, m_tokens.cbegin() + step_begin).size();
+                for (size_t end = step_begin + 1; end < num_kept_tokens; ++end) {
+                    std::string text = decode(context_begin, m_tokens.cbegin() + end);
+                    if (!_ends_with_replacement_character(text) && text.size() >= context_length &&
+                        step_text_begin + text.size() - context_length >= kept_length) {
+                        num_kept_tokens = end;
+                        break;
+                    }
+                }
+            }
+        }
+        MatchStopStringResult result;
+        result.is_matched = true;
+        result.to_remove = num_generated_tokens - num_kept_tokens;
+        return result;
+    }
+
+public:
+    explicit IncrementalStopStringMatcher(std::shared_ptr<const StopStringAutomaton> automaton) :
+        m_automaton(std::move(automaton)) {}
+
+    /**
+     * Feeds the text of the tokens generated since the previous call to the automaton.
+     * @param generated_tokens All tokens generated by the sequence.
+     * @param is_include_to_output Whether the matched stop string is kept in the output.
+     * @param decode Function decoding a span of tokens given by a begin and an end iterator to a string.
+     * @return Whether a stop string has been matched, and the number of last tokens to be removed from the sequence.
+     */
+    template <typename DecodeFunction>
+    MatchStopStringResult match(const std::vector<int64_t>& generated_tokens, bool is_include_to_output, DecodeFunction&& decode) {
+        auto mismatch = std::mismatch(m_tokens.begin(), m_tokens.end(), generated_tokens.begin(), generated_tokens.end());
+        size_t num_common_tokens = mismatch.first - m_tokens.begin();
+        if (num_common_tokens < m_tokens.size()) {
+            _rollback(num_common_tokens);
+        }
+
+        if (!m_is_window_text_valid) {
+            m_window_text.clear();
+            if (m_window_begin < m_tokens.size()) {
+                m_window_text = decode(m_tokens.cbegin() + m_window_begin, m_tokens.cend());
+            }
+            m_is_window_text_valid = true;
+        }
+
+        size_t num_new_tokens = generated_tokens.size() - m_tokens.size();
+        if (num_new_tokens == 0) {
+            return {};
+        }
+        std::string window_text = decode(generated_tokens.begin() + m_window_begin, generated_tokens.end());
+        if (_ends_with_replacement_character(window_text) && num_new_tokens < MAX_PENDING_TOKENS) {
+            return {};
+        }
+
+        size_t match_end = 0, match_length = 0;
+        for (size_t i = _get_new_text_begin(window_text, decode); i < window_text.size(); ++i) {
+            m_text.push_back(window_text[i]);
+            m_state = m_automaton->next(m_state, static_cast<uint8_t>(window_text[i]));
+            if (match_length == 0 && m_automaton->get_match_length(m_state) > 0) {
+                match_end = m_text.size();
+                match_length = m_automaton->get_match_length(m_state);
+            }
+        }
+        m_tokens.insert(m_tokens.end(), generated_tokens.begin() + m_tokens.size(), generated_tokens.end());
+        m_step_ends.emplace_back(m_tokens.size(), m_text.size());
+        m_window_text = std::move(window_text);
+
+        if (match_length > 0) {
+            return _get_match_result(match_end, match_length, generated_tokens.size(), is_include_to_output, decode);
+        }
+        if (m_tokens.size() - m_window_begin > MAX_WINDOW) {
+            _shrink_window();
+        }
+        return {};
+    }
+};
+
+/**
+ * @brief Stop string matching state of a request: the automaton is built once per request and shared by the
+ * incremental matchers of all its sequences.
+ */
+class StopStringMatcher {
+    std::shared_ptr<const StopStringAutomaton> m_automaton;
+    std::unordered_map<uint64_t, IncrementalStopStringMatcher> m_sequence_matchers;
+
+public:
+    explicit StopStringMatcher(const std::set<std::string>& stop_strings) :
+        m_automaton(std::make_shared<StopStringAutomaton>(stop_strings)) {}
+
+    /**
+     * @param seq_id Identifier of the sequence.
+     * @param generated_tokens All tokens generated by the sequence.
+     * @param is_include_to_output Whether the matched stop string is kept in the output.
+     * @param decode Function decoding a span of tokens given by a begin and an end iterator to a string.
+     * @return Whether a stop string has been matched, and the number of last tokens to be removed from the sequence.
+     */
+    template <typename DecodeFunction>
+    MatchStopStringResult match(uint64_t seq_id, const std::vector<int64_t>& generated_tokens, bool is_include_to_output, DecodeFunction&& decode) {
+        auto it = m_sequence_matchers.try_emplace(seq_id, m_automaton).first;
+        return it->second.match(generated_tokens, is_include_to_output, std::forward<DecodeFunction>(decode));
+    }
+
+    /**
+     * Forgets the state of a sequence which is no longer generated.
+     * @param seq_id Identifier of the sequence.
+     */
+    void release(uint64_t seq_id) {
+        m_sequence_matchers.erase(seq_id);
+    }
+};
+
+}  // namespace ov::genai
@@ -1,6 +1,7 @@
 // Copyright (C) 2025-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -10,6 +11,8 @@
 #include <thread>
 #include <utility>
 #include <atomic>
+#include <exception>
+#include <vector>
 
 class ThreadPool {
 
@@ -73,4 +76,83 @@ public:
         cv.notify_one();
         return result;
     }
+
+    /**
+     * @return Number of the pool threads.
+     */
+    size_t size() const {
+        return threads.size();
+    }
+
+    /**
+     * Calls `func(item_idx, worker_idx)` for each item in [0, num_items) on the pool threads and on the calling thread,
+     * returns when all items are processed. Items are split into contiguous ranges, one for each participating thread;
+     * a thread which has processed its own range steals the remaining items from the ranges of other threads.
+     * `worker_idx` identifies the thread within the call and is less than size() + 1, so that it can be used
+     * to select preallocated per-thread buffers. The calling thread has `worker_idx` 0.
+     * The first exception thrown by `func` is rethrown after all threads have stopped.
+     */
+    template <typename F>
+    void parallel_for(size_t num_items, F&& func)
+    {
+        const size_t num_workers = std::min(threads.size() + 1, num_items);
+        if (num_workers <= 1) {
+            for (size_t item_idx = 0; item_idx < num_items; ++item_idx) {
+                func(item_idx, 0);
+            }
+            return;
+        }
+
+        struct Range {
+            std::atomic<size_t> next{0};
+            size_t end = 0;
+        };
+        std::vector<Range> ranges(num_workers);
+        for (size_t worker_idx = 0; worker_idx < num_workers; ++worker_idx) {
+            ranges[worker_idx].next = worker_idx * num_items / num_workers;
+            ranges[worker_idx].end = (worker_idx + 1) * num_items / num_workers;
+        }
+
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+        size_t num_running = num_workers - 1;
+        std::exception_ptr exception;
+
+        auto run = [&](size_t worker_idx) {
+            try {
+                for (size_t offset = 0; offset < num_workers; ++offset) {
+                    Range& range = ranges[(worker_idx + offset) % num_workers];
+                    for (size_t item_idx = range.next++; item_idx < range.end; item_idx = range.next++) {
+                        func(item_idx, worker_idx);
+                    }
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(done_mutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        };
+
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            for (size_t worker_idx = 1; worker_idx < num_workers; ++worker_idx) {
+                tasks.emplace([&, worker_idx]() {
+                    run(worker_idx);
+                    std::lock_guard<std::mutex> done_lock(done_mutex);
+                    if (--num_running == 0) {
+                        done_cv.notify_one();
+                    }
+                });
+            }
+        }
+        cv.notify_all();
+
+        run(0);
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&num_running] { return num_running == 0; });
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
 };
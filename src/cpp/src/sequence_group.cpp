@@ -23,6 +23,8 @@ size_t Sequence::_make_hash(size_t content_length) {
         OPENVINO_ASSERT(filled_blocks_count <= m_prefix_hashes.size());
         if (filled_blocks_count > 0) {
             content.emplace_back(m_prefix_hashes[filled_blocks_count - 1]);
+        } else if (sequence_group->get_prefix_hash_salt() != 0) {
+            content.emplace_back(static_cast<int64_t>(sequence_group->get_prefix_hash_salt()));
         }
 
         // get tokens corresponding to current block
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -173,8 +174,8 @@ public:
             OPENVINO_ASSERT(m_generated_ids.size());
             output.score = get_cumulative_log_prob();
 
-            auto generated_token_id = get_generated_ids();
-            auto generated_log_probs = get_generated_log_probs();
+            const auto& generated_token_id = get_generated_ids();
+            const auto& generated_log_probs = get_generated_log_probs();
 
             OPENVINO_ASSERT(get_generated_len() >= token_cnt);
             if (get_generated_len() > num_token_to_ignore) {
@@ -351,6 +352,13 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // distinguishes KV cache blocks of equal tokens computed differently, e.g. with different LoRA adapters; 0 if unused
+    size_t m_prefix_hash_salt = 0;
+
+    // used to track the time to first token and time per output token deadlines
+    std::chrono::steady_clock::time_point m_arrival_time = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> m_last_token_time;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
@@ -697,9 +705,29 @@ public:
         m_num_processed_tokens += m_num_scheduled_tokens;
         // if some processed tokens were evicted, max content len is greater than number of processed tokens
         m_max_content_len = std::max(m_max_content_len, m_num_processed_tokens);
+        if (m_num_scheduled_tokens > 0 && can_generate_tokens()) {
+            m_last_token_time = std::chrono::steady_clock::now();
+        }
         clear_scheduled_tokens();
     }
 
+    /**
+     * @param now The current time.
+     * @return The time left until the next deadline of the group, i.e. the time to first token deadline before
+     * the first token is generated and the time per output token deadline afterwards, negative if the deadline is missed.
+     * std::nullopt if the corresponding deadline is not set in the generation config.
+     */
+    std::optional<std::chrono::steady_clock::duration> get_deadline_slack(std::chrono::steady_clock::time_point now) const {
+        if (!m_last_token_time.has_value()) {
+            if (m_sampling_params.ttft_deadline_ms == 0)
+                return std::nullopt;
+            return m_arrival_time + std::chrono::milliseconds(m_sampling_params.ttft_deadline_ms) - now;
+        }
+        if (m_sampling_params.tpot_deadline_ms == 0)
+            return std::nullopt;
+        return *m_last_token_time + std::chrono::milliseconds(m_sampling_params.tpot_deadline_ms) - now;
+    }
+
     void update_processed_tokens_num(size_t processed_tokens) {
         m_num_processed_tokens = processed_tokens;
         m_max_content_len = processed_tokens;
@@ -777,6 +805,18 @@ public:
         return m_block_size;
     }
 
+    /**
+     * Sets the value mixed into the hash of the first KV cache block of each sequence, and so into the hashes of all its blocks.
+     * Blocks of requests with different salts are never shared by the prefix cache.
+     */
+    void set_prefix_hash_salt(size_t salt) {
+        m_prefix_hash_salt = salt;
+    }
+
+    size_t get_prefix_hash_salt() const {
+        return m_prefix_hash_salt;
+    }
+
     Sequence::Ptr fork_sequence(Sequence::CPtr sequence) {
         auto forked_sequence = Sequence::fork(sequence, m_next_sequence_id++);
         m_sequences.emplace_back(forked_sequence);
@@ -850,6 +890,21 @@ public:
     }
 
     void push_partial_outputs(size_t token_cnt = 1) {
+        // a single streamed sequence is passed by tokens without building the outputs
+        if (m_sequences.size() == 1 && !(m_sampling_params.echo && !m_has_echoed)) {
+            const auto& sequence = m_sequences.front();
+            const size_t generated_len = sequence->get_generated_len();
+            OPENVINO_ASSERT(generated_len >= token_cnt + m_stream_window_size);
+            const size_t offset = generated_len - token_cnt - m_stream_window_size;
+            m_generation_stream->push_tokens(sequence->get_grouped_id(),
+                                             sequence->get_generated_ids().data() + offset,
+                                             sequence->get_generated_log_probs().data() + offset,
+                                             token_cnt,
+                                             sequence->get_cumulative_log_prob(),
+                                             sequence->get_finish_reason());
+            m_has_echoed = true;
+            return;
+        }
         GenerationOutputs outputs;
         for (auto& sequence : m_sequences) {
             // todo: check seq.is_finished() to generate without several </s>
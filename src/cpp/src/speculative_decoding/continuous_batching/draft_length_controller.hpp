@@ -0,0 +1,170 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+namespace ov::genai {
+
+/**
+ * @brief Chooses the number of draft tokens per request for continuous batching speculative decoding, so that
+ * the expected number of generated tokens per second of compute is maximized.
+ *
+ * Each draft token of a request is assumed to be accepted independently with the request's acceptance probability
+ * `a`, so `k` draft tokens yield (1 - a^(k+1)) / (1 - a) tokens per main model step, including the token sampled by
+ * the main model itself. The cost of a request in a step is its share of the fixed cost of the main model inference
+ * plus the per-token costs of the main and the draft models for its k + 1 tokens. The fixed and per-token costs of
+ * the main model are fitted from the measured step durations, so the longer the batch, the more each wasted draft
+ * token costs compared to the shared fixed cost, and the shorter the chosen draft lengths become.
+ * Acceptance probabilities and costs are averaged with exponential decay to follow changes of the workload.
+ */
+class DraftLengthController {
+    static constexpr double DECAY = 0.9;
+    // the draft length is allowed to grow up to this multiple of the configured one
+    static constexpr size_t MAX_DRAFT_LENGTH_FACTOR = 2;
+
+    struct RequestInfo {
+        size_t max_draft_length;
+        size_t draft_length;
+        // exponentially decayed numbers of accepted draft tokens and of rejections, a rejection ends each step which
+        // does not accept all draft tokens
+        double num_accepted = 0.0, num_rejected = 0.0;
+    };
+
+    std::unordered_map<uint64_t, RequestInfo> m_requests;
+
+    // exponentially decayed sums for the least squares fit of main model step duration = a + b * num_tokens
+    double m_weight = 0.0, m_sum_tokens = 0.0, m_sum_tokens_sq = 0.0, m_sum_seconds = 0.0, m_sum_tokens_seconds = 0.0;
+    // exponentially decayed sums of draft model iterations, their durations and the numbers of drafted requests
+    double m_draft_iterations = 0.0, m_draft_seconds = 0.0, m_draft_requests = 0.0;
+
+    // { fixed seconds, seconds per token } of a main model step, zeros if not enough measurements have been made
+    std::pair<double, double> _get_main_costs() const {
+        double variance = m_weight * m_sum_tokens_sq - m_sum_tokens * m_sum_tokens;
+        // steps of the same size do not allow to separate the per-token cost from the fixed cost
+        if (m_weight < 2.0 || variance <= 1e-9 * m_weight * m_sum_tokens_sq) {
+            return {0.0, 0.0};
+        }
+        double seconds_per_token = std::max(0.0, (m_weight * m_sum_tokens_seconds - m_sum_tokens * m_sum_seconds) / variance);
+        double fixed_seconds = std::max(0.0, (m_sum_seconds - seconds_per_token * m_sum_tokens) / m_weight);
+        return {fixed_seconds, seconds_per_token};
+    }
+
+    static double _get_expected_tokens(double acceptance, size_t draft_length) {
+        if (acceptance >= 1.0) {
+            return static_cast<double>(draft_length + 1);
+        }
+        return (1.0 - std::pow(acceptance, static_cast<double>(draft_length + 1))) / (1.0 - acceptance);
+    }
+
+public:
+    /**
+     * Starts tracking a request.
+     * @param request_id Identifier of the request.
+     * @param num_assistant_tokens The draft length configured for the request, used until costs are measured.
+     */
+    void add_request(uint64_t request_id, size_t num_assistant_tokens) {
+        m_requests.try_emplace(request_id, RequestInfo{num_assistant_tokens * MAX_DRAFT_LENGTH_FACTOR, num_assistant_tokens});
+    }
+
+    void remove_request(uint64_t request_id) {
+        m_requests.erase(request_id);
+    }
+
+    bool has_request(uint64_t request_id) const {
+        return m_requests.count(request_id) > 0;
+    }
+
+    /**
+     * @param request_id Identifier of the request.
+     * @param num_drafted Number of draft tokens validated by the main model at the step.
+     * @param num_accepted Number of draft tokens accepted by the main model at the step.
+     */
+    void register_validation(uint64_t request_id, size_t num_drafted, size_t num_accepted) {
+        auto it = m_requests.find(request_id);
+        if (it == m_requests.end() || num_drafted == 0) {
+            return;
+        }
+        auto& info = it->second;
+        info.num_accepted = info.num_accepted * DECAY + static_cast<double>(std::min(num_accepted, num_drafted));
+        info.num_rejected = info.num_rejected * DECAY + (num_accepted < num_drafted ? 1.0 : 0.0);
+    }
+
+    /**
+     * @param num_tokens Number of tokens processed by the main model at the step.
+     * @param duration Duration of the main model step.
+     */
+    void register_main_step(size_t num_tokens, std::chrono::steady_clock::duration duration) {
+        double seconds = std::chrono::duration<double>(duration).count();
+        double tokens = static_cast<double>(num_tokens);
+        m_weight = m_weight * DECAY + 1.0;
+        m_sum_tokens = m_sum_tokens * DECAY + tokens;
+        m_sum_tokens_sq = m_sum_tokens_sq * DECAY + tokens * tokens;
+        m_sum_seconds = m_sum_seconds * DECAY + seconds;
+        m_sum_tokens_seconds = m_sum_tokens_seconds * DECAY + tokens * seconds;
+    }
+
+    /**
+     * @param num_iterations Number of draft model inferences made to generate the draft tokens.
+     * @param num_requests Number of requests for which the draft tokens have been generated.
+     * @param duration Duration of the draft generation.
+     */
+    void register_draft_steps(size_t num_iterations, size_t num_requests, std::chrono::steady_clock::duration duration) {
+        if (num_iterations == 0 || num_requests == 0) {
+            return;
+        }
+        m_draft_iterations = m_draft_iterations * DECAY + static_cast<double>(num_iterations);
+        m_draft_requests = m_draft_requests * DECAY + static_cast<double>(num_requests * num_iterations);
+        m_draft_seconds = m_draft_seconds * DECAY + std::chrono::duration<double>(duration).count();
+    }
+
+    /**
+     * @param request_id Identifier of a tracked request.
+     * @return Estimated probability that a draft token of the request is accepted.
+     */
+    double get_acceptance(uint64_t request_id) const {
+        const auto& info = m_requests.at(request_id);
+        double num_observations = info.num_accepted + info.num_rejected;
+        return num_observations > 0.0 ? info.num_accepted / num_observations : 1.0;
+    }
+
+    /**
+     * Chooses the draft length of a request for the next step.
+     * @param request_id Identifier of a tracked request.
+     * @param batch_size Number of requests in the batch.
+     * @return Number of draft tokens, at least 1, since the draft model has to process the tokens accepted by
+     * the main model at each step anyway.
+     */
+    size_t get_draft_length(uint64_t request_id, size_t batch_size) {
+        auto& info = m_requests.at(request_id);
+        auto [fixed_seconds, seconds_per_token] = _get_main_costs();
+        if (seconds_per_token == 0.0 || m_draft_iterations == 0.0 || info.num_accepted + info.num_rejected == 0.0) {
+            return info.draft_length;
+        }
+        // the draft model runs one inference per draft token, shared by all requests drafting at that iteration
+        double draft_seconds_per_token = m_draft_seconds / m_draft_requests;
+        // the main model processes the draft tokens and the last accepted token of the request
+        double base_seconds = fixed_seconds / std::max<size_t>(batch_size, 1) + seconds_per_token;
+        double acceptance = get_acceptance(request_id);
+
+        size_t best_draft_length = 1;
+        double best_throughput = 0.0;
+        for (size_t draft_length = 1; draft_length <= info.max_draft_length; ++draft_length) {
+            double seconds = base_seconds + draft_length * (seconds_per_token + draft_seconds_per_token);
+            double throughput = _get_expected_tokens(acceptance, draft_length) / seconds;
+            if (throughput > best_throughput) {
+                best_throughput = throughput;
+                best_draft_length = draft_length;
+            }
+        }
+        info.draft_length = best_draft_length;
+        return best_draft_length;
+    }
+};
+
+}  // namespace ov::genai
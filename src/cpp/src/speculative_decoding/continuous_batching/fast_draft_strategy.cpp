@@ -174,10 +174,20 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_draft_pipeline->pull_awaiting_requests(true);
     m_main_pipeline->pull_awaiting_requests();
 
+    // choose the draft length of each request from its acceptance rate and the current costs of the models
+    auto num_assistant_tokens = m_draft_pipeline->get_num_assistant_tokens();
+    std::map<uint64_t, size_t> draft_lengths;
+    for (const auto& [request_id, request_num_assistant_tokens] : num_assistant_tokens) {
+        m_draft_length_controller.add_request(request_id, request_num_assistant_tokens);
+        draft_lengths[request_id] = m_draft_length_controller.get_draft_length(request_id, num_assistant_tokens.size());
+    }
+    m_draft_pipeline->set_draft_lengths(std::move(draft_lengths));
+
     // generate candidates by draft model
     const auto draft_start = std::chrono::steady_clock::now();
-    m_draft_pipeline->multistep();
+    const size_t num_draft_iterations = m_draft_pipeline->multistep();
     const auto draft_end = std::chrono::steady_clock::now();
+    m_draft_length_controller.register_draft_steps(num_draft_iterations, num_assistant_tokens.size(), draft_end - draft_start);
     m_sd_metrics.draft_duration += PerfMetrics::get_microsec(draft_end - draft_start) / 1e6;
     m_pipeline_metrics = m_main_pipeline->get_metrics();
 
@@ -193,6 +203,11 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     const auto main_start = std::chrono::steady_clock::now();
     m_main_pipeline->step();
     const auto main_end = std::chrono::steady_clock::now();
+    // the cost of the main step depends on all tokens it has inferred, including the prompts of requests in prefill
+    const size_t num_main_tokens = m_main_pipeline->get_scheduled_tokens_per_iteration();
+    if (num_main_tokens > 0) {
+        m_draft_length_controller.register_main_step(num_main_tokens, main_end - main_start);
+    }
     const auto main_duration = PerfMetrics::get_microsec(main_end - main_start);
     m_sd_metrics.main_duration += main_duration / 1e6;
     m_pipeline_metrics = m_main_pipeline->get_metrics();
@@ -210,6 +225,7 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
             m_draft_pipeline->finish_request(request_id);
             // remove draft_generation_handle from queue
             m_draft_generations.erase(request_id);
+            m_draft_length_controller.remove_request(request_id);
         }
         auto updated_seq_info = update_sequence_info[request_id];
         m_sd_metrics.update_draft_generated_len(request_id, updated_seq_info.inserted_tokens_cnt);
@@ -221,6 +237,8 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+        m_draft_length_controller.register_validation(request_id, updated_seq_info.inserted_tokens_cnt,
+                                                      updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt);
     }
 
     const auto step_end = std::chrono::steady_clock::now();
@@ -299,6 +317,9 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_speculative_decoding_me
 void ContinuousBatchingPipeline::SpeculativeDecodingImpl::drop_requests() {
     m_draft_pipeline->finish_request();
     m_main_pipeline->finish_request();
+    for (const auto& [request_id, draft_generation] : m_draft_generations) {
+        m_draft_length_controller.remove_request(request_id);
+    }
 }
 
 
@@ -6,6 +6,7 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "continuous_batching/pipeline_impl.hpp"
 #include "openvino/genai/speculative_decoding/perf_metrics.hpp"
+#include "speculative_decoding/continuous_batching/draft_length_controller.hpp"
 #include "speculative_decoding/continuous_batching/pipeline_impl.hpp"
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
 #include "utils.hpp"
@@ -142,6 +143,7 @@ protected:
     std::shared_ptr<ContinuousBatchingForSpeculativeDecodingImpl> m_main_pipeline, m_draft_pipeline;
     // Metrics
     SpeculativeDecodingMetrics m_sd_metrics;
+    DraftLengthController m_draft_length_controller;
     ov::genai::SDPerModelsPerfMetrics m_perf_metrics;
 
     // Mutex protecting access to m_draft_generations, so add_request and step methods can be called from different threads
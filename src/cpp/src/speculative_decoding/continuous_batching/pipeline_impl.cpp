@@ -31,6 +31,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::finish
         }
     }
     m_sampler->clear_request_info(request->get_request_id());
+    m_draft_lengths.erase(request->get_request_id());
     request->set_generation_status(GenerationStatus::STOP);
 }
 
@@ -343,6 +344,21 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::update
     return result;
 }
 
+std::map<uint64_t, size_t> ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_num_assistant_tokens() const {
+    std::map<uint64_t, size_t> result;
+    for (const auto& request : m_requests) {
+        const auto& sampling_params = request->get_sampling_parameters();
+        if (sampling_params.is_assisting_generation() && sampling_params.assistant_confidence_threshold == 0.f) {
+            result.emplace(request->get_request_id(), sampling_params.num_assistant_tokens);
+        }
+    }
+    return result;
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_draft_lengths(std::map<uint64_t, size_t> draft_lengths) {
+    m_draft_lengths = std::move(draft_lengths);
+}
+
 bool ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::is_requests_empty() {
     return m_requests.empty();
 }
@@ -351,6 +367,10 @@ size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl:
     return m_batch_size;
 }
 
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_scheduled_tokens_per_iteration() const {
+    return m_num_scheduled_tokens;
+}
+
 void
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_awaiting_requests(bool is_pause_request) {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
@@ -363,7 +383,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
-void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
 
@@ -397,7 +417,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == 0 && sampling_params.num_return_sequences > 1) {
                 request->pause_generation(true);
-            } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
+            } else if (sampling_params.assistant_confidence_threshold == 0.f && get_draft_length(request) <= generated_tokens_cnt) {
                 request->pause_generation(true);
             } else if (request->get_max_new_tokens() == 0) {
                 request->pause_generation(true);
@@ -411,5 +431,6 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
     }
     if (eagle_mode_enabled)
         m_model_runner->enable_hidden_state_import(true);
+    return generated_tokens_cnt;
 }
 }
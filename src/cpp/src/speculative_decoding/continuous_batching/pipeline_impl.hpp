@@ -22,7 +22,11 @@ public:
                                                  const ov::AnyMap& plugin_config,
                                                  bool is_validation_mode_enabled);
 
-    void multistep();
+    /**
+     * Generates draft tokens for all requests, each request is paused after its draft length is reached.
+     * @return Number of draft model inferences.
+     */
+    size_t multistep();
 
     void finish_request(int64_t request_id = -1);
     void pull_awaiting_requests(bool is_pause_request = false);
@@ -31,15 +35,29 @@ public:
     bool is_requests_empty();
 
     size_t get_processed_tokens_per_iteration();
+    // number of tokens inferred by the model on the last step: prompt tokens, candidates and last generated tokens
+    size_t get_scheduled_tokens_per_iteration() const;
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    // { request_id, num_assistant_tokens } of requests which generate a fixed number of draft tokens per step
+    std::map<uint64_t, size_t> get_num_assistant_tokens() const;
+    // overrides the number of draft tokens generated by `multistep()` for the given requests
+    void set_draft_lengths(std::map<uint64_t, size_t> draft_lengths);
+
     RawPerfMetrics raw_perf_metrics;
 
 protected:
     void finish_request(SequenceGroup::Ptr request);
     void _pull_awaiting_requests() override {};
     bool eagle_mode_enabled = false;
+    // { request_id, draft_length }
+    std::map<uint64_t, size_t> m_draft_lengths;
+
+    size_t get_draft_length(const SequenceGroup::Ptr& request) const {
+        auto it = m_draft_lengths.find(request->get_request_id());
+        return it != m_draft_lengths.end() ? it->second : request->get_sampling_parameters().num_assistant_tokens;
+    }
 };
 
 class ContinuousBatchingPipeline::ContinuousBatchingForEagle3DecodingImpl
@@ -0,0 +1,146 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "layer_skip_model_transforms.hpp"
+
+#include <cctype>
+#include <map>
+#include <optional>
+#include <unordered_set>
+
+#include "logger.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/util/assign_base.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+namespace layer_skip {
+
+namespace {
+
+// the output of a decoder layer is the residual Add after its MLP, whose down projection consumes the gated activation
+bool is_decoder_layer_output(const std::shared_ptr<ov::Node>& node) {
+    if (!ov::is_type<ov::op::v1::Add>(node)) {
+        return false;
+    }
+    auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node->get_input_node_shared_ptr(1));
+    return matmul && ov::is_type<ov::op::v1::Multiply>(matmul->get_input_node_shared_ptr(0));
+}
+
+// index of the decoder layer from a friendly name like "__module.model.layers.3/aten::add/Add_1"
+std::optional<size_t> get_decoder_layer_index(const std::string& name) {
+    const std::string layers_prefix = "layers.";
+    for (size_t pos = name.find(layers_prefix); pos != std::string::npos; pos = name.find(layers_prefix, pos + 1)) {
+        size_t begin = pos + layers_prefix.size(), end = begin;
+        while (end < name.size() && std::isdigit(static_cast<unsigned char>(name[end]))) {
+            ++end;
+        }
+        if (end > begin && end < name.size() && name[end] == '/') {
+            return std::stoul(name.substr(begin, end - begin));
+        }
+    }
+    return std::nullopt;
+}
+
+bool has_name_with_prefix(const ov::Output<ov::Node>& output, std::initializer_list<const char*> prefixes) {
+    for (const auto& name : output.get_names()) {
+        for (const char* prefix : prefixes) {
+            if (name.rfind(prefix, 0) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// nodes which the results other than the KV cache outputs depend on, the KV cache outputs and states of the kept layers
+// depend only on such nodes too
+std::unordered_set<const ov::Node*> collect_used_nodes(const std::shared_ptr<ov::Model>& model) {
+    std::unordered_set<const ov::Node*> used_nodes;
+    std::vector<const ov::Node*> nodes_to_visit;
+    for (const auto& result : model->get_results()) {
+        if (!has_name_with_prefix(result->input_value(0), {"present."})) {
+            nodes_to_visit.push_back(result.get());
+        }
+    }
+    while (!nodes_to_visit.empty()) {
+        const ov::Node* node = nodes_to_visit.back();
+        nodes_to_visit.pop_back();
+        if (!used_nodes.insert(node).second) {
+            continue;
+        }
+        for (const auto& input : node->input_values()) {
+            nodes_to_visit.push_back(input.get_node());
+        }
+    }
+    return used_nodes;
+}
+
+}  // namespace
+
+std::shared_ptr<ov::Model> create_draft_model(const std::shared_ptr<ov::Model>& main_model, size_t num_draft_layers) {
+    OPENVINO_ASSERT(num_draft_layers > 0, "Self-speculative draft model must keep at least one decoder layer");
+    auto draft_model = main_model->clone();
+
+    std::map<size_t, ov::Output<ov::Node>> layer_outputs;
+    for (const auto& node : draft_model->get_ordered_ops()) {
+        if (!is_decoder_layer_output(node)) {
+            continue;
+        }
+        if (auto layer_index = get_decoder_layer_index(node->get_friendly_name())) {
+            layer_outputs[*layer_index] = node->output(0);
+        }
+    }
+    OPENVINO_ASSERT(!layer_outputs.empty(), "Failed to locate decoder layers in the model for self-speculative decoding.");
+    const size_t num_layers = layer_outputs.rbegin()->first + 1;
+    OPENVINO_ASSERT(layer_outputs.size() == num_layers,
+                    "Failed to locate outputs of all ", num_layers, " decoder layers for self-speculative decoding.");
+    OPENVINO_ASSERT(num_draft_layers < num_layers,
+                    "Number of self-speculative draft layers must be less than the number of decoder layers of the model, got ",
+                    num_draft_layers, " and ", num_layers);
+
+    GENAI_INFO("Creating self-speculative draft model from the first %zu of %zu decoder layers.", num_draft_layers, num_layers);
+
+    // the final norm and the LM head consume the output of the last kept layer instead of the last layer
+    layer_outputs.rbegin()->second.replace(layer_outputs.at(num_draft_layers - 1));
+
+    // the skipped layers are now reachable only from the KV cache outputs and states, which have to be removed
+    auto used_nodes = collect_used_nodes(draft_model);
+
+    auto sinks = draft_model->get_sinks();
+    for (const auto& sink : sinks) {
+        if (used_nodes.count(sink->get_input_node_ptr(0))) {
+            continue;
+        }
+        draft_model->remove_sink(sink);
+        if (auto assign = std::dynamic_pointer_cast<ov::op::util::AssignBase>(sink)) {
+            draft_model->remove_variable(assign->get_variable());
+        }
+    }
+
+    auto results = draft_model->get_results();
+    for (const auto& result : results) {
+        if (!used_nodes.count(result->get_input_node_ptr(0))) {
+            draft_model->remove_result(result);
+        }
+    }
+
+    auto parameters = draft_model->get_parameters();
+    for (const auto& parameter : parameters) {
+        if (!used_nodes.count(parameter.get()) &&
+            has_name_with_prefix(parameter->output(0), {"past_key_values.", "key_cache.", "value_cache."})) {
+            draft_model->remove_parameter(parameter);
+        }
+    }
+
+    draft_model->validate_nodes_and_infer_types();
+    return draft_model;
+}
+
+}  // namespace layer_skip
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
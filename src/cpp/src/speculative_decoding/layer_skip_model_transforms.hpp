@@ -0,0 +1,38 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * @brief Model transformations for self-speculative decoding, where the draft model is the main model with the later
+ * decoder layers skipped.
+ */
+namespace layer_skip {
+
+/**
+ * @brief Creates a draft model which exits early after the first decoder layers of the main model.
+ *
+ * The output of the last kept decoder layer is fed directly to the final norm and the LM head of the main model, and
+ * the skipped decoder layers are removed together with their KV cache inputs, outputs and states. The draft model is
+ * a clone of the main model, so it shares the weight constants of the embeddings, the kept layers and the LM head
+ * with the main model instead of holding a copy of them.
+ *
+ * @param main_model Main model, which is not modified.
+ * @param num_draft_layers Number of the first decoder layers kept in the draft model.
+ * @return The draft model.
+ * @throws Exception if the decoder layers are not found or num_draft_layers is not less than their number.
+ */
+std::shared_ptr<ov::Model> create_draft_model(const std::shared_ptr<ov::Model>& main_model, size_t num_draft_layers);
+
+}  // namespace layer_skip
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
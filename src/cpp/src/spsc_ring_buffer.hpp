@@ -0,0 +1,109 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Lock-free bounded queue for a single producer thread and a single consumer thread. Items are copied into
+ * storage allocated once at construction, so neither pushing nor consuming allocates memory.
+ * Positions of the items are counted from the construction of the buffer, so they can be used to order the items
+ * relative to other events of the producer.
+ */
+template <typename T>
+class SPSCRingBuffer {
+    std::vector<T> m_items;
+    size_t m_mask;
+    // positions of the next item to be consumed and of the next item to be pushed, on separate cache lines since they
+    // are written by different threads
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+
+    static size_t _round_up_to_power_of_two(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+public:
+    /**
+     * @param capacity Minimum number of items the buffer can hold, rounded up to a power of two.
+     */
+    explicit SPSCRingBuffer(size_t capacity) :
+        m_items(_round_up_to_power_of_two(capacity)),
+        m_mask(m_items.size() - 1) {}
+
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    size_t capacity() const {
+        return m_items.size();
+    }
+
+    /**
+     * Pushes all of the items or none of them, so that the consumer never observes a part of them.
+     * Must be called from the producer thread only.
+     * @return false if there is not enough free space for all of the items.
+     */
+    template <typename Generator>
+    bool try_push(size_t count, Generator&& get_item) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail + count - m_head.load(std::memory_order_acquire) > m_items.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            m_items[(tail + i) & m_mask] = get_item(i);
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return Position after the last pushed item, may be called from the producer thread only.
+     */
+    size_t get_push_position() const {
+        return m_tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Consumes items up to a position, must be called from the consumer thread only.
+     * @param end_position Position to stop at, the items pushed after it are left in the buffer.
+     * @param consume Called for each consumed item in the order of pushing.
+     * @return Number of consumed items.
+     */
+    template <typename Consumer>
+    size_t consume(size_t end_position, Consumer&& consume) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        const size_t end = head + std::min(end_position - std::min(end_position, head), tail - head);
+        for (size_t position = head; position < end; ++position) {
+            consume(m_items[position & m_mask]);
+        }
+        m_head.store(end, std::memory_order_release);
+        return end - head;
+    }
+
+    /**
+     * @return Position of the next item to be consumed, may be called from the consumer thread only.
+     */
+    size_t get_consume_position() const {
+        return m_head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Whether there are pushed items which are not consumed yet, may be called from the consumer thread only.
+     */
+    bool has_items() const {
+        return m_tail.load(std::memory_order_acquire) != m_head.load(std::memory_order_relaxed);
+    }
+};
+
+}  // namespace ov::genai
@@ -3,8 +3,11 @@
 
 #include "openvino/genai/text_streamer.hpp"
 
+#include "tokenizer/incremental_detokenizer.hpp"
+#include "tokenizer/tokenizer_impl.hpp"
+
 namespace {
-bool is_incomplete(std::string& text) {
+bool is_incomplete(const std::string& text) {
     // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
     constexpr char replacement[] = "\xef\xbf\xbd";
     return text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0;
@@ -17,18 +20,46 @@ constexpr size_t delay_n_tokens = 3;
 namespace ov {
 namespace genai {
 
+// Is used to hide internal states of TextStreamer
+class TextStreamer::TextStreamerImpl {
+public:
+    explicit TextStreamerImpl(IncrementalDetokenizer detokenizer) : m_detokenizer(std::move(detokenizer)) {}
+
+    // decodes m_tokens_cache incrementally instead of decoding all of the cached tokens for each new token
+    IncrementalDetokenizer m_detokenizer;
+};
+
 TextStreamer::TextStreamer(const Tokenizer& tokenizer,
                            std::function<ov::genai::CallbackTypeVariant(std::string)> callback,
                            const ov::AnyMap& detokenization_params) {
     m_tokenizer = tokenizer;
     m_subword_callback = std::move(callback);
     m_additional_detokenization_params = detokenization_params;
+
+    auto decode = [tokenizer, detokenization_params](const std::vector<int64_t>& tokens) {
+        return tokenizer.decode(tokens, detokenization_params);
+    };
+    const auto& tokenizer_impl = TokenizerInternalAccessor::get_impl(m_tokenizer);
+    if (tokenizer_impl && tokenizer_impl->m_is_byte_level_detokenizer) {
+        std::optional<bool> skip_special_tokens_flag = true;
+        utils::read_anymap_param(detokenization_params, skip_special_tokens.name(), skip_special_tokens_flag);
+        // tokenizers older than 24.5 always skip special tokens
+        const bool skips_special_tokens = *skip_special_tokens_flag || tokenizer_impl->m_older_than_24_5;
+        m_pimpl = std::make_unique<TextStreamerImpl>(IncrementalDetokenizer(
+            decode,
+            &tokenizer_impl->m_vocab,
+            skips_special_tokens ? &tokenizer_impl->m_skipped_tokens_mask : nullptr));
+    } else {
+        m_pimpl = std::make_unique<TextStreamerImpl>(IncrementalDetokenizer(decode));
+    }
 }
 
+TextStreamer::~TextStreamer() = default;
+
 StreamingStatus TextStreamer::write(int64_t token) {
     std::stringstream res;
     m_tokens_cache.push_back(token);
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    const std::string& text = m_pimpl->m_detokenizer.decode(m_tokens_cache);
     m_decoded_lengths.push_back(text.length());
 
     if (!text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
@@ -39,6 +70,7 @@ StreamingStatus TextStreamer::write(int64_t token) {
         m_tokens_cache.clear();
         m_decoded_lengths.clear();
         m_printed_len = 0;
+        m_pimpl->m_detokenizer.reset();
         return res_status;
     }
 
@@ -79,14 +111,8 @@ void TextStreamer::compute_decoded_length_for_position(size_t cache_position) {
         return;
     }
 
-    auto cache_for_position = std::vector(m_tokens_cache.begin(), m_tokens_cache.begin() + cache_position + 1);
-    std::string text_for_position = m_tokenizer.decode(cache_for_position, m_additional_detokenization_params);
-
-    if (is_incomplete(text_for_position)) {
-        m_decoded_lengths[cache_position] = -1;
-    } else {
-        m_decoded_lengths[cache_position] = text_for_position.size();
-    }
+    auto decoded_length = m_pimpl->m_detokenizer.get_decoded_length(m_tokens_cache, cache_position + 1);
+    m_decoded_lengths[cache_position] = decoded_length ? static_cast<int64_t>(*decoded_length) : -1;
 };
 
 StreamingStatus TextStreamer::write(const std::vector<int64_t>& tokens) {
@@ -120,13 +146,18 @@ StreamingStatus TextStreamer::run_callback_if_needed(const std::string& text) {
 
 void TextStreamer::end() {
     std::stringstream res;
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    std::string text = m_pimpl->m_detokenizer.decode(m_tokens_cache);
+    if (is_incomplete(text)) {
+        // the bytes of the incomplete character are replaced by the detokenizer model
+        text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    }
     if (text.size() <= m_printed_len)
         return;
     res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len} << std::flush;
     m_tokens_cache.clear();
     m_decoded_lengths.clear();
     m_printed_len = 0;
+    m_pimpl->m_detokenizer.reset();
     m_subword_callback(res.str());
     return;
 }
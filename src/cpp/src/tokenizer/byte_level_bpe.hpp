@@ -0,0 +1,403 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Host implementation of byte-level BPE tokenization, which encodes ASCII texts without inferring the tokenizer
+ * model. It supports the split patterns of the common byte-level BPE tokenizers, restricted to ASCII, where letters
+ * and numbers are [A-Za-z] and [0-9]. Texts with other characters are left to the tokenizer model.
+ * Encoded words are cached, so that BPE merges are applied once per distinct word.
+ */
+class ByteLevelBPETokenizer {
+public:
+    // split patterns which are applied one after another, isolating the matches from the rest of the text
+    enum class SplitPattern {
+        GPT2,           // 's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
+        CL100K,         // (?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+
+        CL100K_DIGIT,   // the same as CL100K, but with \p{N} instead of \p{N}{1,3}
+        DIGIT,          // \p{N}
+        DIGITS,         // \p{N}+
+        THREE_DIGITS,   // [0-9][0-9][0-9]
+        PUNCTUATION,    // [\p{P}\$\+<=>\^~\|]+
+    };
+
+private:
+    static constexpr size_t MAX_CACHE_SIZE = 1 << 16;
+
+    std::unordered_map<std::string, int64_t> m_token_ids;
+    // (left token, right token) -> (rank, merged token)
+    std::unordered_map<uint64_t, std::pair<size_t, int64_t>> m_merges;
+    // token of each single byte, -1 if there is none
+    std::array<int64_t, 256> m_byte_tokens;
+    // added tokens starting with each byte, in the order of matching them
+    std::array<std::vector<std::pair<std::string, int64_t>>, 256> m_added_tokens;
+    std::vector<SplitPattern> m_split_patterns;
+
+    mutable std::mutex m_cache_mutex;
+    mutable std::unordered_map<std::string, std::vector<int64_t>> m_cache;
+
+    static uint64_t _pair_key(int64_t left, int64_t right) {
+        return (static_cast<uint64_t>(left) << 32) | static_cast<uint32_t>(right);
+    }
+
+    static bool _is_letter(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    static bool _is_digit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool _is_space(char c) {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    static bool _is_newline(char c) {
+        return c == '\r' || c == '\n';
+    }
+
+    // neither a space, nor a letter, nor a number
+    static bool _is_other(char c) {
+        return !_is_space(c) && !_is_letter(c) && !_is_digit(c);
+    }
+
+    template <typename Predicate>
+    static size_t _skip(std::string_view text, size_t pos, Predicate predicate, size_t max_count = std::numeric_limits<size_t>::max()) {
+        size_t end = pos;
+        while (end < text.size() && end - pos < max_count && predicate(text[end])) {
+            ++end;
+        }
+        return end;
+    }
+
+    static size_t _match_contraction(std::string_view text, size_t pos, bool ignore_case) {
+        if (text[pos] != '\'' || pos + 1 >= text.size()) {
+            return 0;
+        }
+        auto lower = [ignore_case](char c) {
+            return ignore_case && c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+        };
+        const char first = lower(text[pos + 1]);
+        if (first == 's' || first == 't' || first == 'm' || first == 'd') {
+            return 2;
+        }
+        if (pos + 2 < text.size()) {
+            const char second = lower(text[pos + 2]);
+            if ((first == 'r' && second == 'e') || (first == 'v' && second == 'e') || (first == 'l' && second == 'l')) {
+                return 3;
+            }
+        }
+        return 0;
+    }
+
+    // \s+(?!\S)|\s+
+    static size_t _match_spaces(std::string_view text, size_t pos) {
+        const size_t end = _skip(text, pos, _is_space);
+        if (end == pos) {
+            return 0;
+        }
+        // leave the last space to the next word
+        if (end < text.size() && end - pos > 1) {
+            return end - 1 - pos;
+        }
+        return end - pos;
+    }
+
+    static size_t _match_gpt2(std::string_view text, size_t pos) {
+        if (size_t length = _match_contraction(text, pos, false)) {
+            return length;
+        }
+        const size_t word = text[pos] == ' ' ? pos + 1 : pos;
+        if (word < text.size()) {
+            const char c = text[word];
+            size_t end = word;
+            if (_is_letter(c)) {
+                end = _skip(text, word, _is_letter);
+            } else if (_is_digit(c)) {
+                end = _skip(text, word, _is_digit);
+            } else if (_is_other(c)) {
+                end = _skip(text, word, _is_other);
+            }
+            if (end > word) {
+                return end - pos;
+            }
+        }
+        return _match_spaces(text, pos);
+    }
+
+    static size_t _match_cl100k(std::string_view text, size_t pos, size_t max_digits) {
+        if (size_t length = _match_contraction(text, pos, true)) {
+            return length;
+        }
+        const char c = text[pos];
+        // [^\r\n\p{L}\p{N}]?\p{L}+
+        if (_is_letter(c)) {
+            return _skip(text, pos, _is_letter) - pos;
+        }
+        if (!_is_newline(c) && !_is_digit(c) && pos + 1 < text.size() && _is_letter(text[pos + 1])) {
+            return _skip(text, pos + 1, _is_letter) - pos;
+        }
+        // \p{N}{1,3}
+        if (_is_digit(c)) {
+            return _skip(text, pos, _is_digit, max_digits) - pos;
+        }
+        // ?[^\s\p{L}\p{N}]+[\r\n]*
+        const size_t word = c == ' ' ? pos + 1 : pos;
+        if (word < text.size() && _is_other(text[word])) {
+            return _skip(text, _skip(text, word, _is_other), _is_newline) - pos;
+        }
+        // \s*[\r\n]+
+        const size_t spaces_end = _skip(text, pos, _is_space);
+        for (size_t end = spaces_end; end > pos; --end) {
+            if (_is_newline(text[end - 1])) {
+                return end - pos;
+            }
+        }
+        return _match_spaces(text, pos);
+    }
+
+    static size_t _match(SplitPattern pattern, std::string_view text, size_t pos) {
+        switch (pattern) {
+        case SplitPattern::GPT2:
+            return _match_gpt2(text, pos);
+        case SplitPattern::CL100K:
+            return _match_cl100k(text, pos, 3);
+        case SplitPattern::CL100K_DIGIT:
+            return _match_cl100k(text, pos, 1);
+        case SplitPattern::DIGIT:
+            return _is_digit(text[pos]) ? 1 : 0;
+        case SplitPattern::DIGITS:
+            return _skip(text, pos, _is_digit) - pos;
+        case SplitPattern::THREE_DIGITS:
+            return _skip(text, pos, _is_digit, 3) - pos == 3 ? 3 : 0;
+        case SplitPattern::PUNCTUATION:
+            // all the ASCII punctuation and symbols except for the grave accent
+            return _skip(text, pos, [](char c) { return _is_other(c) && c != '`'; }) - pos;
+        }
+        return 0;
+    }
+
+    // splits the words by the patterns starting from the given one, encoding the resulting words
+    bool _split_and_encode(std::string_view text, size_t pattern_index, std::vector<int64_t>& tokens) const {
+        if (pattern_index == m_split_patterns.size()) {
+            return _encode_word(text, tokens);
+        }
+        size_t gap_begin = 0;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            const size_t length = _match(m_split_patterns[pattern_index], text, pos);
+            if (length == 0) {
+                ++pos;
+                continue;
+            }
+            if (gap_begin < pos && !_split_and_encode(text.substr(gap_begin, pos - gap_begin), pattern_index + 1, tokens)) {
+                return false;
+            }
+            if (!_split_and_encode(text.substr(pos, length), pattern_index + 1, tokens)) {
+                return false;
+            }
+            pos += length;
+            gap_begin = pos;
+        }
+        return gap_begin == pos || _split_and_encode(text.substr(gap_begin, pos - gap_begin), pattern_index + 1, tokens);
+    }
+
+    bool _encode_word(std::string_view word, std::vector<int64_t>& tokens) const {
+        {
+            std::lock_guard<std::mutex> lock(m_cache_mutex);
+            auto it = m_cache.find(std::string(word));
+            if (it != m_cache.end()) {
+                tokens.insert(tokens.end(), it->second.begin(), it->second.end());
+                return true;
+            }
+        }
+
+        std::vector<int64_t> symbols;
+        symbols.reserve(word.size());
+        for (char c : word) {
+            const int64_t token = m_byte_tokens[static_cast<uint8_t>(c)];
+            if (token < 0) {
+                return false;
+            }
+            symbols.push_back(token);
+        }
+        // merge the pair with the lowest rank until there is none, the leftmost one of the equal pairs first
+        while (symbols.size() > 1) {
+            size_t best_rank = std::numeric_limits<size_t>::max();
+            size_t best_position = 0;
+            int64_t best_token = -1;
+            for (size_t i = 0; i + 1 < symbols.size(); ++i) {
+                auto it = m_merges.find(_pair_key(symbols[i], symbols[i + 1]));
+                if (it != m_merges.end() && it->second.first < best_rank) {
+                    best_rank = it->second.first;
+                    best_position = i;
+                    best_token = it->second.second;
+                }
+            }
+            if (best_token < 0) {
+                break;
+            }
+            symbols[best_position] = best_token;
+            symbols.erase(symbols.begin() + best_position + 1);
+        }
+        tokens.insert(tokens.end(), symbols.begin(), symbols.end());
+
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        if (m_cache.size() >= MAX_CACHE_SIZE) {
+            m_cache.clear();
+        }
+        m_cache.emplace(word, std::move(symbols));
+        return true;
+    }
+
+public:
+    /**
+     * @return Unicode characters representing each byte in the vocabularies of GPT-2 like tokenizers, encoded in UTF-8.
+     */
+    static const std::array<std::string, 256>& get_byte_chars() {
+        static const std::array<std::string, 256> byte_chars = [] {
+            std::array<std::string, 256> chars;
+            uint32_t next_code_point = 256;
+            for (uint32_t byte = 0; byte < 256; ++byte) {
+                const bool is_printable = (byte >= '!' && byte <= '~') || (byte >= 0xA1 && byte <= 0xAC) || byte >= 0xAE;
+                const uint32_t code_point = is_printable ? byte : next_code_point++;
+                if (code_point < 0x80) {
+                    chars[byte] = std::string(1, static_cast<char>(code_point));
+                } else {
+                    chars[byte] = {static_cast<char>(0xC0 | (code_point >> 6)), static_cast<char>(0x80 | (code_point & 0x3F))};
+                }
+            }
+            return chars;
+        }();
+        return byte_chars;
+    }
+
+    /**
+     * @param regex Regular expression of a split step of the tokenizer.
+     * @return The pattern implemented for the expression, nullopt if it is not supported.
+     */
+    static std::optional<SplitPattern> find_split_pattern(std::string regex) {
+        // case insensitive contractions are written either with a flag or with character classes
+        const std::string case_insensitive_flag = "(?i:'s|'t|'re|'ve|'m|'ll|'d)";
+        const std::string case_insensitive_classes = "(?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])";
+        if (regex.compare(0, case_insensitive_classes.size(), case_insensitive_classes) == 0) {
+            regex.replace(0, case_insensitive_classes.size(), case_insensitive_flag);
+        }
+        static const std::vector<std::pair<std::string, SplitPattern>> patterns = {
+            {R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)", SplitPattern::GPT2},
+            {R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S))", SplitPattern::GPT2},
+            {R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)", SplitPattern::CL100K},
+            {R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)", SplitPattern::CL100K_DIGIT},
+            {R"(\p{N})", SplitPattern::DIGIT},
+            {R"(\p{N}+)", SplitPattern::DIGITS},
+            {R"([0-9][0-9][0-9])", SplitPattern::THREE_DIGITS},
+            {R"([\p{P}\$\+<=>\^~\|]+)", SplitPattern::PUNCTUATION},
+        };
+        for (const auto& [pattern_regex, pattern] : patterns) {
+            if (regex == pattern_regex) {
+                return pattern;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @param vocab Tokens indexed by their ids.
+     * @param merges Pairs of tokens in the order of merging.
+     * @param added_tokens Tokens which are matched in the text before splitting it, with their ids. Of the tokens
+     * starting at the same position, the first one in the list is matched, like in an alternation of them.
+     * @param split_patterns Patterns splitting the text into words in the order of applying them.
+     * @param maps_bytes_to_chars Whether the tokens consist of the characters representing bytes instead of the bytes.
+     */
+    ByteLevelBPETokenizer(const std::vector<std::string>& vocab,
+                          const std::vector<std::pair<std::string, std::string>>& merges,
+                          const std::vector<std::pair<std::string, int64_t>>& added_tokens,
+                          std::vector<SplitPattern> split_patterns,
+                          bool maps_bytes_to_chars) :
+        m_split_patterns(std::move(split_patterns)) {
+        m_token_ids.reserve(vocab.size());
+        for (size_t id = 0; id < vocab.size(); ++id) {
+            m_token_ids.emplace(vocab[id], static_cast<int64_t>(id));
+        }
+        auto find_token = [this](const std::string& token) {
+            auto it = m_token_ids.find(token);
+            return it == m_token_ids.end() ? int64_t{-1} : it->second;
+        };
+        for (size_t byte = 0; byte < 256; ++byte) {
+            m_byte_tokens[byte] = find_token(maps_bytes_to_chars ? get_byte_chars()[byte] : std::string(1, static_cast<char>(byte)));
+        }
+        m_merges.reserve(merges.size());
+        for (size_t rank = 0; rank < merges.size(); ++rank) {
+            const auto& [left, right] = merges[rank];
+            const int64_t left_token = find_token(left), right_token = find_token(right), merged_token = find_token(left + right);
+            if (left_token >= 0 && right_token >= 0 && merged_token >= 0) {
+                m_merges.emplace(_pair_key(left_token, right_token), std::make_pair(rank, merged_token));
+            }
+        }
+        for (const auto& [token, id] : added_tokens) {
+            if (!token.empty()) {
+                m_added_tokens[static_cast<uint8_t>(token.front())].emplace_back(token, id);
+            }
+        }
+    }
+
+    std::vector<std::string> get_added_tokens() const {
+        std::vector<std::string> added_tokens;
+        for (const auto& tokens : m_added_tokens) {
+            for (const auto& [token, id] : tokens) {
+                added_tokens.push_back(token);
+            }
+        }
+        return added_tokens;
+    }
+
+    /**
+     * Encodes a text without special tokens added around it.
+     * @return Tokens of the text, nullopt if the text contains characters other than ASCII.
+     */
+    std::optional<std::vector<int64_t>> encode(const std::string& text) const {
+        if (std::any_of(text.begin(), text.end(), [](char c) { return static_cast<uint8_t>(c) >= 0x80; })) {
+            return std::nullopt;
+        }
+        std::vector<int64_t> tokens;
+        std::string_view view(text);
+        size_t segment_begin = 0;
+        for (size_t pos = 0; pos < view.size();) {
+            const auto& candidates = m_added_tokens[static_cast<uint8_t>(view[pos])];
+            auto added_token = std::find_if(candidates.begin(), candidates.end(), [&](const auto& candidate) {
+                return view.compare(pos, candidate.first.size(), candidate.first) == 0;
+            });
+            if (added_token == candidates.end()) {
+                ++pos;
+                continue;
+            }
+            if (!_split_and_encode(view.substr(segment_begin, pos - segment_begin), 0, tokens)) {
+                return std::nullopt;
+            }
+            tokens.push_back(added_token->second);
+            pos += added_token->first.size();
+            segment_begin = pos;
+        }
+        if (!_split_and_encode(view.substr(segment_begin), 0, tokens)) {
+            return std::nullopt;
+        }
+        return tokens;
+    }
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,276 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Decodes a growing sequence of tokens without decoding the whole sequence again for each new token.
+ *
+ * If the detokenizer only concatenates the bytes of the tokens, the text is built on host from the vocabulary, and the
+ * detokenizer model is not inferred at all. Otherwise the model decodes a window of the last tokens, which starts a
+ * few tokens before an anchor position whose text is already known. The text of the new tokens is the part of the
+ * decoded window after the decoded text of the tokens up to the anchor. The context tokens before the anchor keep
+ * normalizations, like removing the space at the beginning of a SentencePiece text, the same as in the whole sequence.
+ * If the new tokens change the text before the anchor, the whole sequence is decoded.
+ */
+class IncrementalDetokenizer {
+public:
+    using DecodeFunction = std::function<std::string(const std::vector<int64_t>& tokens)>;
+
+private:
+    // tokens decoded before the anchor to keep the context of the window
+    static constexpr size_t CONTEXT_TOKENS = 5;
+    // the anchor is moved once the window grows by this number of tokens
+    static constexpr size_t ANCHOR_STRIDE = 16;
+    // number of last tokens whose decoded lengths may be requested, so the anchor is kept before them
+    static constexpr size_t MAX_LOOKBACK = 4;
+
+    DecodeFunction m_decode;
+    const std::vector<std::string>* m_vocab;
+    const std::vector<bool>* m_skipped_tokens;
+    bool m_is_byte_level;
+
+    size_t m_num_tokens = 0;
+    std::string m_text;
+
+    // byte level decoding
+    // lengths of the text after each token, -1 if the text ends with an incomplete character
+    std::vector<int64_t> m_lengths;
+    std::string m_incomplete_char;
+    size_t m_num_missing_bytes = 0;
+    uint8_t m_next_byte_min = 0x80;
+    uint8_t m_next_byte_max = 0xBF;
+    bool m_has_replacement = false;
+
+    // window decoding
+    size_t m_anchor = 0;
+    size_t m_anchor_text_length = 0;
+    size_t m_context_start = 0;
+    // decoded tokens from the context start up to the anchor
+    std::string m_anchor_window;
+
+    static bool _ends_with_replacement(const std::string& text) {
+        constexpr char replacement[] = "\xef\xbf\xbd";
+        return text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0;
+    }
+
+    // validates UTF-8 the same way as the detokenizer does, returns false for a byte which cannot continue the text
+    bool _append_byte(uint8_t byte) {
+        if (m_incomplete_char.empty()) {
+            if (byte < 0x80) {
+                m_text.push_back(static_cast<char>(byte));
+                return true;
+            }
+            if (byte >= 0xC2 && byte <= 0xDF) {
+                m_num_missing_bytes = 1;
+            } else if (byte >= 0xE0 && byte <= 0xEF) {
+                m_num_missing_bytes = 2;
+                // overlong encodings and surrogates are invalid
+                m_next_byte_min = byte == 0xE0 ? 0xA0 : 0x80;
+                m_next_byte_max = byte == 0xED ? 0x9F : 0xBF;
+            } else if (byte >= 0xF0 && byte <= 0xF4) {
+                m_num_missing_bytes = 3;
+                // overlong encodings and code points above U+10FFFF are invalid
+                m_next_byte_min = byte == 0xF0 ? 0x90 : 0x80;
+                m_next_byte_max = byte == 0xF4 ? 0x8F : 0xBF;
+            } else {
+                return false;
+            }
+            m_incomplete_char.push_back(static_cast<char>(byte));
+            return true;
+        }
+        if (byte < m_next_byte_min || byte > m_next_byte_max) {
+            return false;
+        }
+        m_incomplete_char.push_back(static_cast<char>(byte));
+        m_next_byte_min = 0x80;
+        m_next_byte_max = 0xBF;
+        if (--m_num_missing_bytes == 0) {
+            m_text += m_incomplete_char;
+            m_incomplete_char.clear();
+        }
+        return true;
+    }
+
+    // returns false if the tokens cannot be decoded from the vocabulary
+    bool _decode_byte_level(const std::vector<int64_t>& tokens) {
+        if (m_has_replacement && m_num_tokens < tokens.size()) {
+            m_text.resize(m_text.size() - 3);
+            m_has_replacement = false;
+        }
+        for (; m_num_tokens < tokens.size(); ++m_num_tokens) {
+            const int64_t token = tokens[m_num_tokens];
+            if (token < 0 || static_cast<size_t>(token) >= m_vocab->size()) {
+                return false;
+            }
+            if (!m_skipped_tokens || !(*m_skipped_tokens)[token]) {
+                for (char c : (*m_vocab)[token]) {
+                    if (!_append_byte(static_cast<uint8_t>(c))) {
+                        return false;
+                    }
+                }
+            }
+            m_lengths.push_back(m_incomplete_char.empty() ? static_cast<int64_t>(m_text.size()) : -1);
+        }
+        return true;
+    }
+
+    void _switch_to_window_decoding() {
+        reset();
+        m_is_byte_level = false;
+    }
+
+    std::string _decode_range(const std::vector<int64_t>& tokens, size_t begin, size_t end) const {
+        if (begin == 0 && end == tokens.size()) {
+            return m_decode(tokens);
+        }
+        return m_decode(std::vector<int64_t>(tokens.begin() + begin, tokens.begin() + end));
+    }
+
+    // decodes the window up to the given position, nullopt if the text before the anchor is changed
+    std::optional<std::string> _decode_window(const std::vector<int64_t>& tokens, size_t num_tokens) const {
+        std::string window = _decode_range(tokens, m_context_start, num_tokens);
+        if (window.compare(0, m_anchor_window.size(), m_anchor_window) != 0) {
+            return std::nullopt;
+        }
+        return window;
+    }
+
+    void _reset_anchor() {
+        m_anchor = 0;
+        m_anchor_text_length = 0;
+        m_context_start = 0;
+        m_anchor_window.clear();
+    }
+
+    void _move_anchor(const std::vector<int64_t>& tokens) {
+        if (m_num_tokens < m_anchor + ANCHOR_STRIDE + MAX_LOOKBACK) {
+            return;
+        }
+        const size_t anchor = m_num_tokens - MAX_LOOKBACK;
+        auto window = _decode_window(tokens, anchor);
+        if (!window || _ends_with_replacement(*window)) {
+            return;
+        }
+        // the text up to the new anchor has to be a prefix of the current text
+        const size_t new_text_length = window->size() - m_anchor_window.size();
+        if (m_text.compare(m_anchor_text_length, new_text_length, *window, m_anchor_window.size(), new_text_length) != 0) {
+            return;
+        }
+        m_anchor_text_length += new_text_length;
+        m_anchor = anchor;
+        m_context_start = anchor - CONTEXT_TOKENS;
+        m_anchor_window = _decode_range(tokens, m_context_start, anchor);
+    }
+
+    const std::string& _decode_windowed(const std::vector<int64_t>& tokens) {
+        auto window = _decode_window(tokens, tokens.size());
+        if (window) {
+            m_text.resize(m_anchor_text_length);
+            m_text.append(*window, m_anchor_window.size());
+        } else {
+            m_text = m_decode(tokens);
+            _reset_anchor();
+        }
+        m_num_tokens = tokens.size();
+        _move_anchor(tokens);
+        return m_text;
+    }
+
+public:
+    /**
+     * @param decode Function decoding tokens with the detokenizer model.
+     * @param byte_level_vocab Bytes of each token, if the detokenizer only concatenates them and validates UTF-8,
+     * nullptr if the detokenizer normalizes the text. Must outlive the detokenizer.
+     * @param skipped_tokens Mask of the tokens which are skipped in the text, nullptr if none are.
+     * Must outlive the detokenizer.
+     */
+    explicit IncrementalDetokenizer(DecodeFunction decode,
+                                    const std::vector<std::string>* byte_level_vocab = nullptr,
+                                    const std::vector<bool>* skipped_tokens = nullptr) :
+        m_decode(std::move(decode)),
+        m_vocab(byte_level_vocab),
+        m_skipped_tokens(skipped_tokens),
+        m_is_byte_level(byte_level_vocab != nullptr) {}
+
+    /**
+     * Decodes the tokens, which extend the tokens of the previous call since the last reset.
+     * @return Text of the tokens, which ends with the replacement character if the last character is incomplete.
+     */
+    const std::string& decode(const std::vector<int64_t>& tokens) {
+        if (tokens.size() < m_num_tokens) {
+            reset();
+        }
+        if (m_is_byte_level) {
+            if (_decode_byte_level(tokens)) {
+                if (!m_incomplete_char.empty() && !m_has_replacement) {
+                    m_text += "\xef\xbf\xbd";
+                    m_has_replacement = true;
+                }
+                return m_text;
+            }
+            // the text is not valid UTF-8, so it is decoded by the model the same way as replaced invalid bytes
+            _switch_to_window_decoding();
+        }
+        return _decode_windowed(tokens);
+    }
+
+    /**
+     * @param tokens Tokens extending the tokens of the previous call to decode() since the last reset.
+     * @param num_tokens Number of the first tokens to get the length of the text of, not further than a few tokens
+     * before the last decoded token for the cost to be independent of the number of the tokens.
+     * @return Length of the text of the first tokens, nullopt if it ends with an incomplete character.
+     */
+    std::optional<size_t> get_decoded_length(const std::vector<int64_t>& tokens, size_t num_tokens) {
+        if (tokens.size() < m_num_tokens) {
+            reset();
+        }
+        if (m_is_byte_level) {
+            if (_decode_byte_level(tokens)) {
+                if (num_tokens == 0) {
+                    return 0;
+                }
+                const int64_t length = m_lengths[num_tokens - 1];
+                return length < 0 ? std::nullopt : std::optional<size_t>(length);
+            }
+            _switch_to_window_decoding();
+        }
+        if (num_tokens >= m_anchor) {
+            auto window = _decode_window(tokens, num_tokens);
+            if (window) {
+                if (_ends_with_replacement(*window)) {
+                    return std::nullopt;
+                }
+                return m_anchor_text_length + window->size() - m_anchor_window.size();
+            }
+        }
+        std::string text = _decode_range(tokens, 0, num_tokens);
+        return _ends_with_replacement(text) ? std::nullopt : std::optional<size_t>(text.size());
+    }
+
+    /**
+     * Starts decoding a new sequence of tokens.
+     */
+    void reset() {
+        m_is_byte_level = m_vocab != nullptr;
+        m_num_tokens = 0;
+        m_text.clear();
+        m_lengths.clear();
+        m_incomplete_char.clear();
+        m_num_missing_bytes = 0;
+        m_next_byte_min = 0x80;
+        m_next_byte_max = 0xBF;
+        m_has_replacement = false;
+        _reset_anchor();
+    }
+};
+
+}  // namespace ov::genai
@@ -80,7 +80,9 @@ TokenizedInputs Tokenizer::encode(const std::vector<std::string>& prompts, const
     check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
                                           ov::genai::max_length.name(),
                                           ov::genai::pad_to_max_length.name(),
-                                          ov::genai::padding_side.name()});
+                                          ov::genai::padding_side.name(),
+                                          ov::genai::bucket_size.name(),
+                                          ov::genai::return_ragged.name()});
     return m_pimpl->encode(prompts, tokenization_params);
 }
 
@@ -88,7 +90,9 @@ TokenizedInputs Tokenizer::encode(const std::initializer_list<std::string>& text
     check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
                                           ov::genai::max_length.name(),
                                           ov::genai::pad_to_max_length.name(),
-                                          ov::genai::padding_side.name()});
+                                          ov::genai::padding_side.name(),
+                                          ov::genai::bucket_size.name(),
+                                          ov::genai::return_ragged.name()});
     return encode(std::vector<std::string>(text.begin(), text.end()), tokenization_params);
 }
 
@@ -3,9 +3,17 @@
 
 #include "tokenizer/tokenizer_impl.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <numeric>
 #include <utility>
 
 #include "add_second_input_pass.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/op/slice.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 #include "openvino/genai/version.hpp"
 
@@ -156,6 +164,311 @@ std::vector<std::string> read_vocab_from_detokenizer_model(const std::shared_ptr
     return vocab_vector;
 }
 
+std::optional<std::vector<int64_t>> read_skip_tokens_from_detokenizer_model(const std::shared_ptr<ov::Model>& model) {
+    for (auto node : model->get_ordered_ops()) {
+        if (strcmp(node->get_type_info().name, "VocabDecoder") != 0) {
+            continue;
+        }
+        if (node->get_input_size() < 5) {
+            return std::vector<int64_t>{};
+        }
+        // MakeVocabDecoderSatateful slices the skip tokens depending on skip_special_tokens
+        auto skip_tokens_node = node->get_input_node_shared_ptr(4);
+        if (ov::as_type_ptr<ov::op::v8::Slice>(skip_tokens_node)) {
+            skip_tokens_node = skip_tokens_node->get_input_node_shared_ptr(0);
+        }
+        auto skip_tokens_const = ov::as_type_ptr<ov::op::v0::Constant>(skip_tokens_node);
+        if (!skip_tokens_const) {
+            return std::nullopt;
+        }
+        return skip_tokens_const->cast_vector<int64_t>();
+    }
+    return std::nullopt;
+}
+
+// Checks that the detokenizer only concatenates the bytes of the tokens and replaces invalid UTF-8,
+// so that the text can be built from the vocabulary. Operations from opsets only handle shapes and states.
+bool is_byte_level_detokenizer_model(const std::shared_ptr<ov::Model>& model) {
+    static const std::set<std::string> byte_level_operations = {"VocabDecoder", "FuzeRagged", "UTF8Validate", "StringTensorPack"};
+    bool validates_utf8 = false;
+    for (auto node : model->get_ordered_ops()) {
+        const auto& type_info = node->get_type_info();
+        if (type_info.version_id && strncmp(type_info.version_id, "opset", 5) == 0) {
+            continue;
+        }
+        if (byte_level_operations.count(type_info.name) == 0) {
+            return false;
+        }
+        validates_utf8 |= strcmp(type_info.name, "UTF8Validate") == 0;
+    }
+    return validates_utf8;
+}
+
+// Reads the string and boolean attributes of an operation.
+class ReadStringAndFlagAttributes : public ov::AttributeVisitor {
+private:
+    std::map<std::string, std::string> m_strings;
+    std::map<std::string, bool> m_flags;
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        m_strings[name] = adapter.get();
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        m_flags[name] = adapter.get();
+    }
+
+    std::optional<std::string> get_string(const std::string& name) const {
+        auto it = m_strings.find(name);
+        return it == m_strings.end() ? std::nullopt : std::optional<std::string>(it->second);
+    }
+
+    std::optional<bool> get_flag(const std::string& name) const {
+        auto it = m_flags.find(name);
+        return it == m_flags.end() ? std::nullopt : std::optional<bool>(it->second);
+    }
+};
+
+// Reads constant strings given either as begins, ends and chars inputs starting from begins_index,
+// or as a string constant unpacked by StringTensorUnpack.
+std::optional<std::vector<std::string>> read_constant_strings(const std::shared_ptr<ov::Node>& node, size_t begins_index) {
+    if (node->get_input_size() < begins_index + 3) {
+        return std::nullopt;
+    }
+    auto begins_node = node->get_input_node_shared_ptr(begins_index);
+    if (strcmp(begins_node->get_type_info().name, "StringTensorUnpack") == 0) {
+        auto strings_const = ov::as_type_ptr<ov::op::v0::Constant>(begins_node->get_input_node_shared_ptr(0));
+        if (!strings_const) {
+            return std::nullopt;
+        }
+        if (strings_const->get_element_type() == ov::element::string) {
+            const auto* strings = strings_const->get_data_ptr<std::string>();
+            return std::vector<std::string>(strings, strings + ov::shape_size(strings_const->get_shape()));
+        }
+        // strings packed to bytes: the number of strings, the offsets of the strings and their chars
+        const auto packed = strings_const->cast_vector<uint8_t>();
+        auto read_int32 = [&packed](size_t index) {
+            int32_t value;
+            std::memcpy(&value, packed.data() + index * sizeof(int32_t), sizeof(int32_t));
+            return value;
+        };
+        if (packed.size() < sizeof(int32_t)) {
+            return std::nullopt;
+        }
+        const int32_t num_strings = read_int32(0);
+        const size_t chars_offset = (num_strings + 2) * sizeof(int32_t);
+        if (num_strings < 0 || packed.size() < chars_offset) {
+            return std::nullopt;
+        }
+        std::vector<std::string> strings(num_strings);
+        for (int32_t i = 0; i < num_strings; ++i) {
+            const int32_t begin = read_int32(i + 1), end = read_int32(i + 2);
+            if (begin < 0 || begin > end || chars_offset + end > packed.size()) {
+                return std::nullopt;
+            }
+            strings[i].assign(packed.begin() + chars_offset + begin, packed.begin() + chars_offset + end);
+        }
+        return strings;
+    }
+    auto begins_const = ov::as_type_ptr<ov::op::v0::Constant>(begins_node);
+    auto ends_const = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(begins_index + 1));
+    auto chars_const = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(begins_index + 2));
+    if (!begins_const || !ends_const || !chars_const) {
+        return std::nullopt;
+    }
+    const auto begins = begins_const->cast_vector<int32_t>();
+    const auto ends = ends_const->cast_vector<int32_t>();
+    const auto chars = chars_const->cast_vector<uint8_t>();
+    if (begins.size() != ends.size()) {
+        return std::nullopt;
+    }
+    std::vector<std::string> strings(begins.size());
+    for (size_t i = 0; i < begins.size(); ++i) {
+        if (begins[i] < 0 || begins[i] > ends[i] || static_cast<size_t>(ends[i]) > chars.size()) {
+            return std::nullopt;
+        }
+        strings[i].assign(chars.begin() + begins[i], chars.begin() + ends[i]);
+    }
+    return strings;
+}
+
+std::optional<std::string> read_constant_string(const ov::Output<ov::Node>& output) {
+    auto string_const = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!string_const) {
+        return std::nullopt;
+    }
+    if (string_const->get_element_type() == ov::element::string) {
+        if (ov::shape_size(string_const->get_shape()) != 1) {
+            return std::nullopt;
+        }
+        return *string_const->get_data_ptr<std::string>();
+    }
+    const auto chars = string_const->cast_vector<uint8_t>();
+    return std::string(chars.begin(), chars.end());
+}
+
+// Creates the host tokenizer for a tokenizer model consisting of byte-level BPE and the split patterns implemented by
+// ByteLevelBPETokenizer, nullptr for other models. Operations from opsets only handle shapes and states.
+std::unique_ptr<ByteLevelBPETokenizer> create_byte_level_bpe_tokenizer(const std::shared_ptr<ov::Model>& model) {
+    static const std::set<std::string> supported_operations = {
+        "StringTensorUnpack", "SpecialTokensSplit", "RegexSplit", "BytesToChars", "BPETokenizer",
+        "Truncate", "CombineSegments", "RaggedToDense",
+    };
+    std::shared_ptr<ov::Node> bpe_node;
+    bool splits_special_tokens = false;
+    bool maps_bytes_to_chars = false;
+    std::vector<ByteLevelBPETokenizer::SplitPattern> split_patterns;
+    for (auto node : model->get_ordered_ops()) {
+        const auto& type_info = node->get_type_info();
+        if (type_info.version_id && strncmp(type_info.version_id, "opset", 5) == 0) {
+            continue;
+        }
+        const std::string name = type_info.name;
+        if (supported_operations.count(name) == 0) {
+            return nullptr;
+        }
+        if (name == "BPETokenizer") {
+            if (bpe_node) {
+                return nullptr;
+            }
+            bpe_node = node;
+        } else if (name == "SpecialTokensSplit") {
+            splits_special_tokens = true;
+        } else if (name == "BytesToChars") {
+            maps_bytes_to_chars = true;
+        } else if (name == "RegexSplit") {
+            // splits happen before BPE, so the patterns are read in the order of applying them
+            if (bpe_node || node->get_input_size() < 6) {
+                return nullptr;
+            }
+            ReadStringAndFlagAttributes attributes;
+            node->visit_attributes(attributes);
+            auto regex = read_constant_string(node->input_value(5));
+            if (!regex || attributes.get_string("behaviour") != "isolate" || attributes.get_flag("invert").value_or(false)) {
+                return nullptr;
+            }
+            auto pattern = ByteLevelBPETokenizer::find_split_pattern(*regex);
+            if (!pattern) {
+                return nullptr;
+            }
+            split_patterns.push_back(*pattern);
+        }
+    }
+    if (!bpe_node) {
+        return nullptr;
+    }
+
+    ReadStringAndFlagAttributes attributes;
+    bpe_node->visit_attributes(attributes);
+    if (!attributes.get_string("suffix_indicator").value_or("").empty() || !attributes.get_string("end_suffix").value_or("").empty()) {
+        return nullptr;
+    }
+
+    // the merges are given either as pairs split into the left and right tokens or as "left right" strings
+    const size_t num_inputs = bpe_node->get_input_size();
+    const bool has_split_merges = num_inputs == 14 || num_inputs == 18;
+    const size_t special_tokens_index = has_split_merges ? 14 : 11;
+    if (num_inputs != special_tokens_index && num_inputs != special_tokens_index + 4) {
+        return nullptr;
+    }
+    auto vocab = read_constant_strings(bpe_node, 5);
+    if (!vocab) {
+        return nullptr;
+    }
+    std::vector<std::pair<std::string, std::string>> merges;
+    if (has_split_merges) {
+        auto left_merges = read_constant_strings(bpe_node, 8);
+        auto right_merges = read_constant_strings(bpe_node, 11);
+        if (!left_merges || !right_merges || left_merges->size() != right_merges->size()) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < left_merges->size(); ++i) {
+            merges.emplace_back((*left_merges)[i], (*right_merges)[i]);
+        }
+    } else {
+        auto joined_merges = read_constant_strings(bpe_node, 8);
+        if (!joined_merges) {
+            return nullptr;
+        }
+        for (const auto& merge : *joined_merges) {
+            const size_t space = merge.find(' ');
+            if (space == std::string::npos) {
+                return nullptr;
+            }
+            merges.emplace_back(merge.substr(0, space), merge.substr(space + 1));
+        }
+    }
+
+    std::vector<std::pair<std::string, int64_t>> added_tokens;
+    if (num_inputs == special_tokens_index + 4 && splits_special_tokens) {
+        auto special_tokens = read_constant_strings(bpe_node, special_tokens_index);
+        auto special_token_ids_const = ov::as_type_ptr<ov::op::v0::Constant>(bpe_node->get_input_node_shared_ptr(special_tokens_index + 3));
+        if (!special_tokens || !special_token_ids_const) {
+            return nullptr;
+        }
+        const auto special_token_ids = special_token_ids_const->cast_vector<int64_t>();
+        if (special_tokens->size() != special_token_ids.size()) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < special_tokens->size(); ++i) {
+            added_tokens.emplace_back((*special_tokens)[i], special_token_ids[i]);
+        }
+    }
+
+    return std::make_unique<ByteLevelBPETokenizer>(*vocab, merges, added_tokens, std::move(split_patterns), maps_bytes_to_chars);
+}
+
+// Reads the number of tokens of the prompt kept by the Truncate operation by default, max if there is no Truncate
+// operation, std::nullopt if the limit cannot be read. MakeAddSpecialTokensSatateful replaces the limit with
+// Select(is_max_length_set, max_length - num_added_tokens, no_limit), where max_length is set only by tokenization
+// parameters, which are never encoded on host.
+std::optional<size_t> read_truncation_limit(const std::shared_ptr<ov::Model>& model) {
+    size_t limit = std::numeric_limits<size_t>::max();
+    for (auto node : model->get_ordered_ops()) {
+        if (strcmp(node->get_type_info().name, "Truncate") != 0) {
+            continue;
+        }
+        // the inputs of a single prompt are followed by max_length
+        if (node->get_input_size() < 4) {
+            return std::nullopt;
+        }
+        auto max_length = node->get_input_node_shared_ptr(3);
+        if (auto select = ov::as_type_ptr<ov::op::v1::Select>(max_length)) {
+            auto is_max_length_set = ov::as_type_ptr<ov::op::v6::ReadValue>(select->get_input_node_shared_ptr(0));
+            if (!is_max_length_set || is_max_length_set->get_variable_id() != IS_MAX_LENGTH_SET) {
+                return std::nullopt;
+            }
+            max_length = select->get_input_node_shared_ptr(2);
+        }
+        auto max_length_const = ov::as_type_ptr<ov::op::v0::Constant>(max_length);
+        if (!max_length_const || ov::shape_size(max_length_const->get_shape()) != 1) {
+            return std::nullopt;
+        }
+        limit = std::min(limit, static_cast<size_t>(std::max<int64_t>(max_length_const->cast_vector<int64_t>()[0], 0)));
+    }
+    return limit;
+}
+
+// Reads the default padding side and the padding value of input_ids from the first RaggedToDense operation.
+void read_padding_from_tokenizer_model(const std::shared_ptr<ov::Model>& model, bool& pad_right, int64_t& padding_value) {
+    for (auto node : model->get_ordered_ops()) {
+        if (strcmp(node->get_type_info().name, "RaggedToDense") != 0) {
+            continue;
+        }
+        ReadStringAndFlagAttributes attributes;
+        node->visit_attributes(attributes);
+        pad_right = attributes.get_flag("pad_right").value_or(pad_right);
+        if (node->get_input_size() > 4) {
+            if (auto padding_const = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(4))) {
+                padding_value = padding_const->cast_vector<int64_t>().at(0);
+            }
+        }
+        return;
+    }
+}
+
 template <typename T>
 void Tokenizer::TokenizerImpl::set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags) {
     // better to store which value is in the state locally so that get_state is not called every infer request
@@ -403,6 +716,8 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
     }
 
     if (ov_tokenizer) {
+        read_padding_from_tokenizer_model(ov_tokenizer, m_pad_right, m_padding_value);
+
         ov::pass::Manager manager;
         manager.register_pass<MakeAddSpecialTokensSatateful>();
         manager.register_pass<MakePaddingSatateful>();
@@ -452,6 +767,8 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
             });
             req.start_async();
         }
+
+        setup_byte_level_bpe_tokenizer(ov_tokenizer);
     }
 
     if (ov_detokenizer) {
@@ -498,6 +815,17 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
         }
 
         m_vocab = read_vocab_from_detokenizer_model(ov_detokenizer);
+
+        auto skip_tokens = read_skip_tokens_from_detokenizer_model(ov_detokenizer);
+        m_is_byte_level_detokenizer = !m_vocab.empty() && skip_tokens && is_byte_level_detokenizer_model(ov_detokenizer);
+        m_skipped_tokens_mask.assign(m_vocab.size(), false);
+        if (skip_tokens) {
+            for (int64_t token : *skip_tokens) {
+                if (token >= 0 && static_cast<size_t>(token) < m_vocab.size()) {
+                    m_skipped_tokens_mask[token] = true;
+                }
+            }
+        }
     }
 }
 
@@ -621,9 +949,130 @@ void Tokenizer::TokenizerImpl::infer_special_tokens_if_necessary() {
     get_id_from_str(m_eos_token, m_eos_token_id);
 }
 
+// Enables encoding on host if the tokenizer model is byte-level BPE supported by ByteLevelBPETokenizer
+// and the host results match the results of the model for the probe texts.
+void Tokenizer::TokenizerImpl::setup_byte_level_bpe_tokenizer(const std::shared_ptr<ov::Model>& ov_tokenizer) {
+    if (is_paired_input) {
+        return;
+    }
+    std::unique_ptr<ByteLevelBPETokenizer> bpe_tokenizer;
+    try {
+        bpe_tokenizer = create_byte_level_bpe_tokenizer(ov_tokenizer);
+    } catch (const ov::Exception&) {
+        return;
+    }
+    if (!bpe_tokenizer) {
+        return;
+    }
+    auto truncation_limit = read_truncation_limit(ov_tokenizer);
+    if (!truncation_limit) {
+        return;
+    }
+
+    std::vector<std::string> probes = {
+        "Hello, world! It's a simple test.",
+        "They'll've said: \"we'd, you're, I'M, it'S\" 'RE 'Ve",
+        "  leading, trailing   and\tmixed \t spaces  ",
+        "line\n\n\nbreaks \r\n and\r\n\n  indents\n    end\n",
+        "0123456789 1234567 x1y22z333 3.14159 -42 1e-10",
+        "def f(x):\n    return x**2 + 1  # comment\n\n\tprint(f'{x!r}')",
+        "`~!@#$%^&*()_+-=[]{}|;':\",./<>?\\ ... --> <== &&",
+        "x",
+    };
+    // probes for the added tokens, which can be encoded on host
+    constexpr size_t max_added_token_probes = 8;
+    const size_t num_text_probes = probes.size();
+    for (const auto& token : bpe_tokenizer->get_added_tokens()) {
+        if (probes.size() == num_text_probes + max_added_token_probes) {
+            break;
+        }
+        if (std::all_of(token.begin(), token.end(), [](char c) { return static_cast<uint8_t>(c) < 0x80; })) {
+            probes.push_back("Hi" + token + " there\n" + token + token + "1");
+        }
+    }
+
+    // older tokenizers do not support changing add_special_tokens, so only the default one is used
+    const std::vector<bool> add_special_tokens_values = m_older_than_24_5 ? std::vector<bool>{true} : std::vector<bool>{false, true};
+    std::array<std::pair<std::vector<int64_t>, std::vector<int64_t>>, 2> added_special_tokens;
+    try {
+        for (bool add_special_tokens_value : add_special_tokens_values) {
+            auto& [prefix, suffix] = added_special_tokens[add_special_tokens_value];
+            for (size_t probe_index = 0; probe_index < probes.size(); ++probe_index) {
+                const auto& probe = probes[probe_index];
+                auto host_tokens = bpe_tokenizer->encode(probe);
+                if (!host_tokens) {
+                    return;
+                }
+                ov::AnyMap params = m_older_than_24_5 ? ov::AnyMap{} : ov::AnyMap{ov::genai::add_special_tokens(add_special_tokens_value)};
+                TokenizedInputs inputs = encode(probe, params);
+                const int64_t* ids = inputs.input_ids.data<int64_t>();
+                const int64_t* mask = inputs.attention_mask.data<int64_t>();
+                const size_t size = inputs.input_ids.get_size();
+                if (std::any_of(mask, mask + size, [](int64_t value) { return value != 1; })) {
+                    return;
+                }
+                std::vector<int64_t> model_tokens(ids, ids + size);
+                if (probe_index == 0) {
+                    // the added special tokens are found around the tokens of the first probe
+                    auto it = std::search(model_tokens.begin(), model_tokens.end(), host_tokens->begin(), host_tokens->end());
+                    if (it == model_tokens.end()) {
+                        return;
+                    }
+                    prefix.assign(model_tokens.begin(), it);
+                    suffix.assign(it + host_tokens->size(), model_tokens.end());
+                }
+                host_tokens->insert(host_tokens->begin(), prefix.begin(), prefix.end());
+                host_tokens->insert(host_tokens->end(), suffix.begin(), suffix.end());
+                if (*host_tokens != model_tokens) {
+                    return;
+                }
+            }
+        }
+    } catch (const ov::Exception&) {
+        return;
+    }
+    if (m_older_than_24_5) {
+        added_special_tokens[false] = added_special_tokens[true];
+    }
+    m_added_special_tokens = std::move(added_special_tokens);
+    m_host_max_num_tokens = *truncation_limit;
+    m_byte_level_bpe_tokenizer = std::move(bpe_tokenizer);
+}
+
+std::optional<TokenizedInputs> Tokenizer::TokenizerImpl::encode_on_host(const std::string& prompt, const ov::AnyMap& tokenization_params) {
+    if (!m_byte_level_bpe_tokenizer) {
+        return std::nullopt;
+    }
+    bool add_special_tokens_flag = true;
+    for (const auto& [key, value] : tokenization_params) {
+        if (key != add_special_tokens.name()) {
+            return std::nullopt;
+        }
+        add_special_tokens_flag = value.as<bool>();
+    }
+    auto tokens = m_byte_level_bpe_tokenizer->encode(prompt);
+    // prompts truncated by the model are encoded by the model
+    if (!tokens || tokens->size() > m_host_max_num_tokens) {
+        return std::nullopt;
+    }
+    const auto& [prefix, suffix] = m_added_special_tokens[add_special_tokens_flag];
+    const size_t size = prefix.size() + tokens->size() + suffix.size();
+    ov::Tensor input_ids(ov::element::i64, {1, size});
+    ov::Tensor attention_mask(ov::element::i64, {1, size});
+    int64_t* ids = input_ids.data<int64_t>();
+    ids = std::copy(prefix.begin(), prefix.end(), ids);
+    ids = std::copy(tokens->begin(), tokens->end(), ids);
+    std::copy(suffix.begin(), suffix.end(), ids);
+    std::fill_n(attention_mask.data<int64_t>(), size, 1);
+    return TokenizedInputs{input_ids, attention_mask};
+}
+
 TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::string& prompt, const ov::AnyMap& tokenization_params) {
     OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                             "Tokenizer::encode is not available");
+    if (auto inputs = encode_on_host(prompt, tokenization_params)) {
+        return *inputs;
+    }
 
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
     set_state_if_necessary(infer_request_guard, tokenization_params);
@@ -698,6 +1147,14 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>&
 TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
     OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                             "Tokenizer::encode is not available");
+    std::optional<size_t> bucket_size_val;
+    bool return_ragged_flag = false;
+    ov::genai::utils::read_anymap_param(tokenization_params, bucket_size.name(), bucket_size_val);
+    ov::genai::utils::read_anymap_param(tokenization_params, return_ragged.name(), return_ragged_flag);
+    const bool is_bucketed = bucket_size_val.value_or(0) > 0 && prompts.size() > *bucket_size_val;
+    if (is_bucketed || return_ragged_flag) {
+        return encode_in_buckets(prompts, tokenization_params, bucket_size_val.value_or(0), return_ragged_flag);
+    }
 
     TokenizedInputs unpadded;
     {
@@ -725,6 +1182,124 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>&
     return {unpadded.input_ids, unpadded.attention_mask};
 }
 
+// Tokenizes buckets of prompts of similar lengths concurrently. Each worker holds one infer request at a time and takes
+// the next bucket until none is left, so concurrent calls cannot block each other while waiting for more requests.
+TokenizedInputs Tokenizer::TokenizerImpl::encode_in_buckets(const std::vector<std::string>& prompts,
+                                                            const ov::AnyMap& tokenization_params,
+                                                            size_t bucket_size,
+                                                            bool ragged) {
+    const size_t batch_size = prompts.size();
+    const bool is_bucketed = bucket_size > 0 && batch_size > bucket_size;
+    std::vector<size_t> order(batch_size);
+    std::iota(order.begin(), order.end(), 0);
+    if (is_bucketed) {
+        std::stable_sort(order.begin(), order.end(), [&prompts](size_t lhs, size_t rhs) {
+            return prompts[lhs].size() < prompts[rhs].size();
+        });
+    } else {
+        bucket_size = std::max<size_t>(batch_size, 1);
+    }
+    const size_t num_buckets = (batch_size + bucket_size - 1) / bucket_size;
+
+    std::vector<TokenizedInputs> bucket_results(num_buckets);
+    std::atomic<size_t> next_bucket{0};
+    auto tokenize_buckets = [&]() {
+        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
+        set_state_if_necessary(infer_request_guard, tokenization_params);
+        ov::InferRequest& infer_request = infer_request_guard.get();
+        std::vector<std::string> bucket_prompts;
+        for (size_t bucket = next_bucket++; bucket < num_buckets; bucket = next_bucket++) {
+            const size_t begin = bucket * bucket_size;
+            const size_t end = std::min(begin + bucket_size, batch_size);
+            // the const_cast is safe since the prompts are not modified by inference
+            std::string* bucket_data = const_cast<std::string*>(prompts.data());
+            if (is_bucketed) {
+                bucket_prompts.clear();
+                for (size_t i = begin; i < end; ++i) {
+                    bucket_prompts.push_back(prompts[order[i]]);
+                }
+                bucket_data = bucket_prompts.data();
+            }
+            infer_request.set_input_tensor(0, ov::Tensor{ov::element::string, {end - begin}, bucket_data});
+            if (infer_request.get_compiled_model().inputs().size() > 1) {
+                infer_request.set_input_tensor(1, ov::Tensor{ov::element::string, {0}});
+            }
+            infer_request.infer();
+            bucket_results[bucket] = get_copied_results(infer_request.get_tensor("input_ids"), infer_request.get_tensor("attention_mask"));
+        }
+    };
+    const size_t num_workers = std::min(num_buckets, m_ireq_queue_tokenizer->size());
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < num_workers; ++i) {
+        workers.push_back(std::async(std::launch::async, tokenize_buckets));
+    }
+    tokenize_buckets();
+    for (auto& worker : workers) {
+        worker.get();
+    }
+
+    // row of each prompt in the results of its bucket
+    auto get_row = [&](const TokenizedInputs& result, size_t row, const int64_t*& ids, const int64_t*& mask) {
+        OPENVINO_ASSERT(result.input_ids.get_element_type() == ov::element::i64 && result.attention_mask.get_element_type() == ov::element::i64,
+                        "input_ids and attention_mask are expected to be i64 tensors");
+        const size_t width = result.input_ids.get_shape().at(1);
+        ids = result.input_ids.data<int64_t>() + row * width;
+        mask = result.attention_mask.data<int64_t>() + row * width;
+        return width;
+    };
+
+    if (ragged) {
+        // the tokens of a prompt are the ones which are not masked in its row
+        std::vector<int64_t> offsets(batch_size + 1, 0);
+        for (size_t i = 0; i < batch_size; ++i) {
+            const int64_t* ids;
+            const int64_t* mask;
+            const size_t width = get_row(bucket_results[i / bucket_size], i % bucket_size, ids, mask);
+            offsets[order[i] + 1] = std::count(mask, mask + width, 1);
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        ov::Tensor input_ids(ov::element::i64, {static_cast<size_t>(offsets.back())});
+        ov::Tensor attention_mask(ov::element::i64, {static_cast<size_t>(offsets.back())});
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+        for (size_t i = 0; i < batch_size; ++i) {
+            const int64_t* ids;
+            const int64_t* mask;
+            const size_t width = get_row(bucket_results[i / bucket_size], i % bucket_size, ids, mask);
+            int64_t* prompt_ids = input_ids.data<int64_t>() + offsets[order[i]];
+            for (size_t j = 0; j < width; ++j) {
+                if (mask[j] == 1) {
+                    *prompt_ids++ = ids[j];
+                }
+            }
+        }
+        ov::Tensor offsets_tensor(ov::element::i64, {offsets.size()});
+        std::copy(offsets.begin(), offsets.end(), offsets_tensor.data<int64_t>());
+        return {input_ids, attention_mask, std::nullopt, offsets_tensor};
+    }
+
+    // rows of buckets are padded further to the longest bucket on the same side as the model pads them
+    std::optional<std::string> padding_side_val;
+    ov::genai::utils::read_anymap_param(tokenization_params, padding_side.name(), padding_side_val);
+    const bool pad_right = padding_side_val ? *padding_side_val == "right" : m_pad_right;
+    size_t max_width = 0;
+    for (const auto& result : bucket_results) {
+        max_width = std::max(max_width, result.input_ids.get_shape().at(1));
+    }
+    ov::Tensor input_ids(ov::element::i64, {batch_size, max_width});
+    ov::Tensor attention_mask(ov::element::i64, {batch_size, max_width});
+    std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), m_padding_value);
+    std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+    for (size_t i = 0; i < batch_size; ++i) {
+        const int64_t* ids;
+        const int64_t* mask;
+        const size_t width = get_row(bucket_results[i / bucket_size], i % bucket_size, ids, mask);
+        const size_t offset = order[i] * max_width + (pad_right ? 0 : max_width - width);
+        std::copy_n(ids, width, input_ids.data<int64_t>() + offset);
+        std::copy_n(mask, width, attention_mask.data<int64_t>() + offset);
+    }
+    return {input_ids, attention_mask};
+}
+
 TokenizedInputs Tokenizer::TokenizerImpl::get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
     ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
     ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
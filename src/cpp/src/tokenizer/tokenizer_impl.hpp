@@ -4,6 +4,7 @@
 #pragma once
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <memory>
 
 #include "minja/minja.hpp"
@@ -13,6 +14,7 @@
 #include "openvino/runtime/core.hpp"
 
 #include "gguf_utils/gguf_tokenizer.hpp"
+#include "tokenizer/byte_level_bpe.hpp"
 #include "tokenizer/chat_template_fallback_map.hpp"
 #include "tokenizer/make_tokenizer_stateful.hpp"
 #include "tokenizer/tokenizers_path.hpp"
@@ -44,6 +46,19 @@ public:
     std::string m_chat_template = {};
     std::string m_original_chat_template = {};
     std::vector<std::string> m_vocab = {};
+    // the detokenizer only concatenates the bytes of m_vocab tokens, so the text can be decoded without inference
+    bool m_is_byte_level_detokenizer = false;
+    // tokens which the detokenizer skips when skip_special_tokens is set
+    std::vector<bool> m_skipped_tokens_mask = {};
+    // encodes the prompts it supports on host, set only if its results match the tokenizer model
+    std::unique_ptr<ByteLevelBPETokenizer> m_byte_level_bpe_tokenizer = nullptr;
+    // tokens the tokenizer model adds before and after the prompt, indexed by add_special_tokens
+    std::array<std::pair<std::vector<int64_t>, std::vector<int64_t>>, 2> m_added_special_tokens = {};
+    // the number of prompt tokens the tokenizer model keeps by default, longer prompts are encoded by the model
+    size_t m_host_max_num_tokens = std::numeric_limits<size_t>::max();
+    // default padding of the tokenizer model, used to put the results of buckets together
+    bool m_pad_right = true;
+    int64_t m_padding_value = 0;
     std::shared_ptr<StructuredOutputController> m_structured_output_controller = nullptr;
 
     template <typename T>
@@ -61,12 +76,16 @@ public:
     void read_special_tokens_map(const std::filesystem::path& tokenizer_path);
     void read_tokenizer_config_if_necessary(const std::filesystem::path& tokenizer_path);
     void infer_special_tokens_if_necessary();
+    void setup_byte_level_bpe_tokenizer(const std::shared_ptr<ov::Model>& ov_tokenizer);
 
     TokenizedInputs encode(const std::string& prompt, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::pair<std::string, std::string>>& prompts_pairs, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::string>& prompts_1, const std::vector<std::string>& prompts_2, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
 
+    TokenizedInputs encode_in_buckets(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params, size_t bucket_size, bool ragged);
+    std::optional<TokenizedInputs> encode_on_host(const std::string& prompt, const ov::AnyMap& tokenization_params);
+
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask);
 
     std::string decode(const std::vector<int64_t>& tokens, const ov::AnyMap& detokenization_params = {});
@@ -85,5 +104,14 @@ public:
     std::shared_ptr<StructuredOutputController> get_structured_output_controller(std::optional<int> vocab_size = std::nullopt);
 };
 
+// Gives the library internals access to the implementation of a Tokenizer, so that the public classes using it,
+// like TextStreamer, do not need to be friends of Tokenizer.
+class TokenizerInternalAccessor {
+public:
+    static const std::shared_ptr<Tokenizer::TokenizerImpl>& get_impl(const Tokenizer& tokenizer) {
+        return tokenizer.m_pimpl;
+    }
+};
+
 }  // namespace genai
 }  // namespace ov
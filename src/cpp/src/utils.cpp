@@ -405,7 +405,7 @@ std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  c
     auto [filtered_properties, enable_save_ov_model] = extract_gguf_properties(properties);
     if (is_gguf_model(model_dir)) {
 #ifdef ENABLE_GGUF
-        return create_from_gguf(model_dir.string(), enable_save_ov_model);
+        return create_from_gguf(model_dir.string(), enable_save_ov_model, filtered_properties);
 #else
         OPENVINO_ASSERT("GGUF support is switched off. Please, recompile with 'cmake -DENABLE_GGUF=ON'");
 #endif
@@ -760,6 +760,14 @@ bool explicitly_requires_paged_attention(const ov::AnyMap& properties, bool is_n
         }
     }
 
+    if (properties.find(ov::genai::self_speculative_draft_layers.name()) != properties.end()) {
+        if (is_paged_attention_available()) {
+            return true;
+        } else {
+            OPENVINO_THROW("Self-speculative decoding requires PagedAttention operation support, which is available on x86_64 or ARM64 platforms only");
+        }
+    }
+
     auto prompt_lookup_prop = properties.find(ov::genai::prompt_lookup.name());
     if (prompt_lookup_prop != properties.end() && prompt_lookup_prop->second.as<bool>() == true) {
         if (is_paged_attention_available()) {
@@ -116,6 +116,8 @@ public:
             : utils::pop_or_default<ov::AnyMap>(device_properties, device, {});
 
         if (m_generation_config.adapters) {
+            OPENVINO_ASSERT(m_generation_config.adapters->get_mode() != AdapterConfig::MODE_PER_REQUEST,
+                            "AdapterConfig::MODE_PER_REQUEST is supported by ContinuousBatchingPipeline only");
             m_generation_config.adapters->set_tensor_name_prefix(
                 m_generation_config.adapters->get_tensor_name_prefix().value_or("base_model.model.")
             );
@@ -191,6 +193,8 @@ public:
         auto kv_pos = ov::genai::utils::get_kv_axes_pos(language_model);
 
         if (m_generation_config.adapters) {
+            OPENVINO_ASSERT(m_generation_config.adapters->get_mode() != AdapterConfig::MODE_PER_REQUEST,
+                            "AdapterConfig::MODE_PER_REQUEST is supported by ContinuousBatchingPipeline only");
             m_generation_config.adapters->set_tensor_name_prefix(
                 m_generation_config.adapters->get_tensor_name_prefix().value_or("base_model.model.")
             );
@@ -116,6 +116,7 @@ from .py_openvino_genai import (
     GenerationResult,
     GenerationStatus,
     SchedulerConfig,
+    AdmissionPolicy,
     CacheEvictionConfig,
     AggregationMode,
     SparseAttentionMode,
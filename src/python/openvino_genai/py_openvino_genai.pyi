@@ -5,7 +5,7 @@ from __future__ import annotations
 import collections.abc
 import openvino._pyopenvino
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AdmissionPolicy', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -44,13 +44,16 @@ class AdapterConfig:
           MODE_STATIC
         
           MODE_FUSE
+        
+          MODE_PER_REQUEST
         """
         MODE_AUTO: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_AUTO: 0>
         MODE_DYNAMIC: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_DYNAMIC: 1>
         MODE_FUSE: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_FUSE: 4>
+        MODE_PER_REQUEST: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_PER_REQUEST: 5>
         MODE_STATIC: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_STATIC: 3>
         MODE_STATIC_RANK: typing.ClassVar[AdapterConfig.Mode]  # value = <Mode.MODE_STATIC_RANK: 2>
-        __members__: typing.ClassVar[dict[str, AdapterConfig.Mode]]  # value = {'MODE_AUTO': <Mode.MODE_AUTO: 0>, 'MODE_DYNAMIC': <Mode.MODE_DYNAMIC: 1>, 'MODE_STATIC_RANK': <Mode.MODE_STATIC_RANK: 2>, 'MODE_STATIC': <Mode.MODE_STATIC: 3>, 'MODE_FUSE': <Mode.MODE_FUSE: 4>}
+        __members__: typing.ClassVar[dict[str, AdapterConfig.Mode]]  # value = {'MODE_AUTO': <Mode.MODE_AUTO: 0>, 'MODE_DYNAMIC': <Mode.MODE_DYNAMIC: 1>, 'MODE_STATIC_RANK': <Mode.MODE_STATIC_RANK: 2>, 'MODE_STATIC': <Mode.MODE_STATIC: 3>, 'MODE_FUSE': <Mode.MODE_FUSE: 4>, 'MODE_PER_REQUEST': <Mode.MODE_PER_REQUEST: 5>}
         def __eq__(self, other: typing.Any) -> bool:
             ...
         def __getstate__(self) -> int:
@@ -106,12 +109,16 @@ class AdapterConfig:
         ...
     def get_alpha(self, adapter: Adapter) -> float:
         ...
+    def get_max_resident_adapters(self) -> int:
+        ...
     def remove(self, adapter: Adapter) -> AdapterConfig:
         ...
     def set_adapters_and_alphas(self, adapters: collections.abc.Sequence[tuple[Adapter, typing.SupportsFloat]]) -> None:
         ...
     def set_alpha(self, adapter: Adapter, alpha: typing.SupportsFloat) -> AdapterConfig:
         ...
+    def set_max_resident_adapters(self, max_resident_adapters: typing.SupportsInt) -> None:
+        ...
 class AdaptiveRKVConfig:
     """
     Configuration struct for the Adaptive R-KV cache eviction algorithm
@@ -130,6 +137,48 @@ class AdaptiveRKVConfig:
     @window_size.setter
     def window_size(self, arg0: typing.SupportsInt) -> None:
         ...
+class AdmissionPolicy:
+    """
+    Represents the order in which requests waiting for their prompt to be processed are admitted by the scheduler.
+                                   :param AdmissionPolicy.FCFS: Requests are admitted in the order they were added to the pipeline.
+                                   :param AdmissionPolicy.CACHE_AWARE: Requests with longer prefix cache hits are admitted first, requests sharing an uncached prefix wait until the prefix is computed by one of them. Requires prefix caching to be enabled.
+    
+    
+    Members:
+    
+      FCFS
+    
+      CACHE_AWARE
+    """
+    CACHE_AWARE: typing.ClassVar[AdmissionPolicy]  # value = <AdmissionPolicy.CACHE_AWARE: 1>
+    FCFS: typing.ClassVar[AdmissionPolicy]  # value = <AdmissionPolicy.FCFS: 0>
+    __members__: typing.ClassVar[dict[str, AdmissionPolicy]]  # value = {'FCFS': <AdmissionPolicy.FCFS: 0>, 'CACHE_AWARE': <AdmissionPolicy.CACHE_AWARE: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class AggregationMode:
     """
     Represents the mode of per-token score aggregation when determining least important tokens for eviction from cache
@@ -636,6 +685,10 @@ class ContinuousBatchingPipeline:
         ...
     def has_non_finished_requests(self) -> bool:
         ...
+    def load_prefix_cache(self, path: os.PathLike | str | bytes) -> bool:
+        ...
+    def save_prefix_cache(self, path: os.PathLike | str | bytes) -> None:
+        ...
     def start_chat(self, system_message: str = '') -> None:
         ...
     def step(self) -> None:
@@ -963,6 +1016,12 @@ class GenerationConfig:
         top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
         do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
         num_return_sequences: the number of sequences to generate from a single prompt.
+    
+        Scheduling parameters (supported by ContinuousBatching backend only):
+        priority:           the priority class of the request. Requests of higher priority are scheduled first and are preempted last.
+        ttft_deadline_ms:   the desired time to first token in milliseconds, 0 means no deadline. Among requests of the same priority,
+                            waiting requests closer to their deadlines are admitted first.
+        tpot_deadline_ms:   the desired time per output token in milliseconds, 0 means no deadline. Orders preempted requests waiting to be resumed.
     """
     adapters: openvino_genai.py_openvino_genai.AdapterConfig | None
     apply_chat_template: bool
@@ -1099,6 +1158,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def pruning_ratio(self) -> int:
         ...
     @pruning_ratio.setter
@@ -1152,6 +1217,18 @@ class GenerationConfig:
     @top_p.setter
     def top_p(self, arg0: typing.SupportsFloat) -> None:
         ...
+    @property
+    def tpot_deadline_ms(self) -> int:
+        ...
+    @tpot_deadline_ms.setter
+    def tpot_deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def ttft_deadline_ms(self) -> int:
+        ...
+    @ttft_deadline_ms.setter
+    def ttft_deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
 class GenerationFinishReason:
     """
     Members:
@@ -1841,6 +1918,12 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (supported by ContinuousBatching backend only):
+            priority:           the priority class of the request. Requests of higher priority are scheduled first and are preempted last.
+            ttft_deadline_ms:   the desired time to first token in milliseconds, 0 means no deadline. Among requests of the same priority,
+                                waiting requests closer to their deadlines are admitted first.
+            tpot_deadline_ms:   the desired time per output token in milliseconds, 0 means no deadline. Orders preempted requests waiting to be resumed.
         """
     @typing.overload
     def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
@@ -1938,6 +2021,12 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (supported by ContinuousBatching backend only):
+            priority:           the priority class of the request. Requests of higher priority are scheduled first and are preempted last.
+            ttft_deadline_ms:   the desired time to first token in milliseconds, 0 means no deadline. Among requests of the same priority,
+                                waiting requests closer to their deadlines are admitted first.
+            tpot_deadline_ms:   the desired time per output token in milliseconds, 0 means no deadline. Orders preempted requests waiting to be resumed.
         """
     def get_generation_config(self) -> GenerationConfig:
         ...
@@ -2494,6 +2583,8 @@ class SchedulerConfig:
         cache_size:                 total size of KV cache in GB.
         block_size:                 block size for KV cache.
         dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+        swap_space:                 size of the host memory pool in GB used to preempt sequences by swapping their KV-blocks
+            instead of recomputing them. 0 disables swapping.
     
         vLLM-like settings:
         max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -2503,14 +2594,25 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        prefix_cache_offload_size:  Size of the host RAM tier of the prefix cache in GB. When non-zero, prefix-cached
+            KV-blocks which have to be overwritten in the KV-cache are copied to host memory and restored from there
+            instead of being recomputed.
+        prefix_cache_offload_dir:   Directory to spill KV-blocks evicted from the host RAM tier of the prefix cache to.
+        prefix_cache_offload_dir_size: Maximum total size of KV-blocks spilled to prefix_cache_offload_dir in GB.
+        prefix_cache_snapshot_path: Path to a prefix cache snapshot to warm-start the prefix cache from, if the file exists.
+        admission_policy:           Order in which waiting requests are admitted, has effect only if prefix caching is enabled.
+        admission_max_wait_steps:   Number of scheduling steps after which a waiting request is admitted in arrival order.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
         sparse_attention_config     Sparse attention configuration struct.
     """
+    admission_policy: AdmissionPolicy
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    prefix_cache_offload_dir: str
+    prefix_cache_snapshot_path: str
     sparse_attention_config: SparseAttentionConfig
     use_cache_eviction: bool
     use_sparse_attention: bool
@@ -2519,6 +2621,12 @@ class SchedulerConfig:
     def to_string(self) -> str:
         ...
     @property
+    def admission_max_wait_steps(self) -> int:
+        ...
+    @admission_max_wait_steps.setter
+    def admission_max_wait_steps(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def cache_size(self) -> int:
         ...
     @cache_size.setter
@@ -2542,6 +2650,24 @@ class SchedulerConfig:
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def prefix_cache_offload_dir_size(self) -> int:
+        ...
+    @prefix_cache_offload_dir_size.setter
+    def prefix_cache_offload_dir_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def prefix_cache_offload_size(self) -> int:
+        ...
+    @prefix_cache_offload_size.setter
+    def prefix_cache_offload_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_space(self) -> int:
+        ...
+    @swap_space.setter
+    def swap_space(self, arg0: typing.SupportsInt) -> None:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -3760,6 +3886,7 @@ class TextStreamer(StreamerBase):
 class TokenizedInputs:
     attention_mask: openvino._pyopenvino.Tensor
     input_ids: openvino._pyopenvino.Tensor
+    offsets: openvino._pyopenvino.Tensor | None
     def __init__(self, input_ids: openvino._pyopenvino.Tensor, attention_mask: openvino._pyopenvino.Tensor) -> None:
         ...
 class Tokenizer:
@@ -3803,7 +3930,7 @@ class Tokenizer:
         Decode a batch of tokens into a list of string prompt.
         """
     @typing.overload
-    def encode(self, prompts: collections.abc.Sequence[str], add_special_tokens: bool = True, pad_to_max_length: bool = False, max_length: typing.SupportsInt | None = None, padding_side: str | None = None) -> TokenizedInputs:
+    def encode(self, prompts: collections.abc.Sequence[str], add_special_tokens: bool = True, pad_to_max_length: bool = False, max_length: typing.SupportsInt | None = None, padding_side: str | None = None, bucket_size: typing.SupportsInt | None = None, return_ragged: bool = False) -> TokenizedInputs:
         """
         Encodes a list of prompts into tokenized inputs.
         Args:
@@ -3812,6 +3939,8 @@ class Tokenizer:
          'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
          'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
          'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+         'bucket_size' - number of prompts in a bucket. If set, larger batches are sorted by prompt length and split into buckets, which are tokenized concurrently. The order of the results is the order of the prompts.
+         'return_ragged' - whether to return the tokens of all prompts without padding in 1D tensors, with the tokens of the i-th prompt in [offsets[i], offsets[i + 1]). Default is False.
         Returns:
          TokenizedInputs object containing input_ids and attention_mask tensors.
         """
@@ -20,6 +20,7 @@ namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::AggregationMode;
 using ov::genai::SparseAttentionMode;
+using ov::genai::AdmissionPolicy;
 using ov::genai::CacheEvictionConfig;
 using ov::genai::SparseAttentionConfig;
 using ov::genai::ContinuousBatchingPipeline;
@@ -113,6 +114,8 @@ auto scheduler_config_docstring = R"(
     cache_size:                 total size of KV cache in GB.
     block_size:                 block size for KV cache.
     dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+    swap_space:                 size of the host memory pool in GB used to preempt sequences by swapping their KV-blocks
+        instead of recomputing them. 0 disables swapping.
 
     vLLM-like settings:
     max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -122,6 +125,14 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    prefix_cache_offload_size:  Size of the host RAM tier of the prefix cache in GB. When non-zero, prefix-cached
+        KV-blocks which have to be overwritten in the KV-cache are copied to host memory and restored from there
+        instead of being recomputed.
+    prefix_cache_offload_dir:   Directory to spill KV-blocks evicted from the host RAM tier of the prefix cache to.
+    prefix_cache_offload_dir_size: Maximum total size of KV-blocks spilled to prefix_cache_offload_dir in GB.
+    prefix_cache_snapshot_path: Path to a prefix cache snapshot to warm-start the prefix cache from, if the file exists.
+    admission_policy:           Order in which waiting requests are admitted, has effect only if prefix caching is enabled.
+    admission_max_wait_steps:   Number of scheduling steps after which a waiting request is admitted in arrival order.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -354,6 +365,14 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .value("TRISHAPE", SparseAttentionMode::TRISHAPE)
 			.value("XATTENTION", SparseAttentionMode::XATTENTION);
 
+    py::enum_<AdmissionPolicy>(m, "AdmissionPolicy",
+                            R"(Represents the order in which requests waiting for their prompt to be processed are admitted by the scheduler.
+                               :param AdmissionPolicy.FCFS: Requests are admitted in the order they were added to the pipeline.
+                               :param AdmissionPolicy.CACHE_AWARE: Requests with longer prefix cache hits are admitted first, requests sharing an uncached prefix wait until the prefix is computed by one of them. Requires prefix caching to be enabled.
+)")
+            .value("FCFS", AdmissionPolicy::FCFS)
+            .value("CACHE_AWARE", AdmissionPolicy::CACHE_AWARE);
+
     py::class_<SparseAttentionConfig>(m, "SparseAttentionConfig", sparse_attention_config_docstring)
             .def(py::init<>([](SparseAttentionMode mode, size_t num_last_dense_tokens_in_prefill, size_t num_retained_start_tokens_in_cache, size_t num_retained_recent_tokens_in_cache, float xattention_threshold, size_t xattention_block_size, size_t xattention_stride) {
                  // somehow pybind cannot associate enum arg with a default value with its python counterpart,
@@ -381,8 +400,15 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("num_kv_blocks", &SchedulerConfig::num_kv_blocks)
         .def_readwrite("cache_size", &SchedulerConfig::cache_size)
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
+        .def_readwrite("swap_space", &SchedulerConfig::swap_space)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("prefix_cache_offload_size", &SchedulerConfig::prefix_cache_offload_size)
+        .def_readwrite("prefix_cache_offload_dir", &SchedulerConfig::prefix_cache_offload_dir)
+        .def_readwrite("prefix_cache_offload_dir_size", &SchedulerConfig::prefix_cache_offload_dir_size)
+        .def_readwrite("prefix_cache_snapshot_path", &SchedulerConfig::prefix_cache_snapshot_path)
+        .def_readwrite("admission_policy", &SchedulerConfig::admission_policy)
+        .def_readwrite("admission_max_wait_steps", &SchedulerConfig::admission_max_wait_steps)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
@@ -433,6 +459,8 @@ void init_continuous_batching_pipeline(py::module_& m) {
 
         .def("start_chat", &ContinuousBatchingPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &ContinuousBatchingPipeline::finish_chat)
+        .def("save_prefix_cache", &ContinuousBatchingPipeline::save_prefix_cache, py::arg("path"))
+        .def("load_prefix_cache", &ContinuousBatchingPipeline::load_prefix_cache, py::arg("path"))
 
         .def(
             "generate",
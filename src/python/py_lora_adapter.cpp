@@ -48,7 +48,8 @@ void init_lora_adapter(py::module_& m) {
         .value("MODE_DYNAMIC", ov::genai::AdapterConfig::Mode::MODE_DYNAMIC)
         .value("MODE_STATIC_RANK", ov::genai::AdapterConfig::Mode::MODE_STATIC_RANK)
         .value("MODE_STATIC", ov::genai::AdapterConfig::Mode::MODE_STATIC)
-        .value("MODE_FUSE", ov::genai::AdapterConfig::Mode::MODE_FUSE);
+        .value("MODE_FUSE", ov::genai::AdapterConfig::Mode::MODE_FUSE)
+        .value("MODE_PER_REQUEST", ov::genai::AdapterConfig::Mode::MODE_PER_REQUEST);
 
     adapter_config.def(py::init([](
          ov::genai::AdapterConfig::Mode mode) {
@@ -104,4 +105,6 @@ void init_lora_adapter(py::module_& m) {
     adapter_config.def("add", static_cast<ov::genai::AdapterConfig& (ov::genai::AdapterConfig::*)(const ov::genai::Adapter&)>(&ov::genai::AdapterConfig::add), py::arg("adapter"));
     adapter_config.def("get_adapters_and_alphas", &ov::genai::AdapterConfig::get_adapters_and_alphas);
     adapter_config.def("set_adapters_and_alphas", &ov::genai::AdapterConfig::set_adapters_and_alphas, py::arg("adapters"));
+    adapter_config.def("get_max_resident_adapters", &ov::genai::AdapterConfig::get_max_resident_adapters);
+    adapter_config.def("set_max_resident_adapters", &ov::genai::AdapterConfig::set_max_resident_adapters, py::arg("max_resident_adapters"));
 }
@@ -40,8 +40,16 @@ Returns:
 auto encode_list_docstring = (
 R"(Encodes a list of prompts into tokenized inputs.
 Args:
- 'prompts' - list of prompts to encode)"
-+ std::string(common_encode_docstring)
+ 'prompts' - list of prompts to encode
+ 'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+ 'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
+ 'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+ 'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+ 'bucket_size' - number of prompts in a bucket. If set, larger batches are sorted by prompt length and split into buckets, which are tokenized concurrently. The order of the results is the order of the prompts.
+ 'return_ragged' - whether to return the tokens of all prompts without padding in 1D tensors, with the tokens of the i-th prompt in [offsets[i], offsets[i + 1]). Default is False.
+Returns:
+ TokenizedInputs object containing input_ids and attention_mask tensors.
+)"
 );
 
 auto encode_single_prompt_docstring = (
@@ -82,7 +90,8 @@ void init_tokenizer(py::module_& m) {
     py::class_<TokenizedInputs>(m, "TokenizedInputs")
         .def(py::init<ov::Tensor, ov::Tensor>(), py::arg("input_ids"), py::arg("attention_mask"))
         .def_readwrite("input_ids", &TokenizedInputs::input_ids)
-        .def_readwrite("attention_mask", &TokenizedInputs::attention_mask);
+        .def_readwrite("attention_mask", &TokenizedInputs::attention_mask)
+        .def_readwrite("offsets", &TokenizedInputs::offsets);
 
     py::class_<ov::genai::Tokenizer>(m, "Tokenizer", class_docstring)
 
@@ -113,10 +122,13 @@ void init_tokenizer(py::module_& m) {
                           bool add_special_tokens, 
                           bool pad_to_max_length,
                           std::optional<size_t> max_length,
-                          std::optional<std::string> padding_side) {
+                          std::optional<std::string> padding_side,
+                          std::optional<size_t> bucket_size,
+                          bool return_ragged) {
                 ov::AnyMap tokenization_params;
                 tokenization_params[ov::genai::add_special_tokens.name()] = add_special_tokens;
                 tokenization_params[ov::genai::pad_to_max_length.name()] = pad_to_max_length;
+                tokenization_params[ov::genai::return_ragged.name()] = return_ragged;
 
                 if (max_length.has_value()) {
                     tokenization_params[ov::genai::max_length.name()] = *max_length;
@@ -124,6 +136,9 @@ void init_tokenizer(py::module_& m) {
                 if (padding_side.has_value()) {
                     tokenization_params[ov::genai::padding_side.name()] = *padding_side;
                 }
+                if (bucket_size.has_value()) {
+                    tokenization_params[ov::genai::bucket_size.name()] = *bucket_size;
+                }
                 return tok.encode(prompts, tokenization_params);
             },
             py::arg("prompts"),
@@ -131,6 +146,8 @@ void init_tokenizer(py::module_& m) {
             py::arg("pad_to_max_length") = false,
             py::arg("max_length") = std::nullopt,
             py::arg("padding_side") = std::nullopt,
+            py::arg("bucket_size") = std::nullopt,
+            py::arg("return_ragged") = false,
             encode_list_docstring.c_str())
 
         .def("encode", [](Tokenizer& tok, const std::string prompt, 
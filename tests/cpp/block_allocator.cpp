@@ -22,7 +22,7 @@ TEST_P(TestBlockAllocatorWithNumLayers, AllocatesBlocksAccordingToNumLayers) {
         EXPECT_EQ(allocator.num_free_blocks(i), initial_num_free_blocks - 1);
     }
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer> cached_blocks_map;
+    ov::genai::PrefixHashToBlocksMap cached_blocks_map;
     allocator.free(blocks, cached_blocks_map);
 }
 
@@ -101,7 +101,7 @@ protected:
     size_t num_layers = 3;
     size_t initial_num_free_blocks = 10;
     ov::genai::BlockAllocator allocator;
-    std::map<uint64_t, ov::genai::BlocksPerLayer> cached_blocks_map;
+    ov::genai::PrefixHashToBlocksMap cached_blocks_map;
 };
 
 TEST_F(PrefixCachingBlockAllocatorTest, OnlyAllocatesAndFreesBlocksFromAllLayers) {
@@ -202,7 +202,7 @@ TEST_F(PrefixCachingBlockAllocatorTest, ThrowsAtAllocationWhenFull) {
 
 TEST_F(PrefixCachingBlockAllocatorTest, HandlesHashCollisionsAtFreeCorrectly) {
     // TODO (vshampor): also handle collisions during allocations (multimap instead of map?)
-    auto cached_blocks_map = std::map<uint64_t, ov::genai::BlocksPerLayer>{};
+    auto cached_blocks_map = ov::genai::PrefixHashToBlocksMap{};
     auto first_hash_0_block = allocator.allocate_block(0, cached_blocks_map);
     allocator.free(first_hash_0_block, cached_blocks_map);
     ASSERT_EQ(allocator.num_overwriteable_blocks(), 1);
@@ -218,7 +218,7 @@ TEST_F(PrefixCachingBlockAllocatorTest, HandlesHashCollisionsAtFreeCorrectly) {
     allocator.free(second_hash_0_block, cached_blocks_map);
     EXPECT_EQ(allocator.num_overwriteable_blocks(), 1);
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer>
+    ov::genai::PrefixHashToBlocksMap
         empty_map{};  // to force allocator to take the block from overwritable store
     auto internal_overwriteable_block = allocator.get_cached_block(0, empty_map);
     for (size_t layer_idx = 0; layer_idx < internal_overwriteable_block.size(); layer_idx++) {
@@ -231,7 +231,7 @@ TEST_F(PrefixCachingBlockAllocatorTest, HandlesHashCollisionsAtFreeCorrectly) {
 
 TEST_F(PrefixCachingBlockAllocatorTest, HandlesPrefixHashMapAtHashCollisionCorrectly) {
     auto alloc = ov::genai::BlockAllocator(5, true, 1);
-    std::map<uint64_t, ov::genai::BlocksPerLayer> cached;
+    ov::genai::PrefixHashToBlocksMap cached;
 
     const uint64_t H = 100;
 
@@ -270,7 +270,7 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectly) {
     auto one_block_from_some_layer = allocator.allocate_block(7);
     EXPECT_NEAR(allocator.get_used_percentage(), 11.0, 1e-5);
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer> cached_blocks_map;
+    ov::genai::PrefixHashToBlocksMap cached_blocks_map;
     allocator.free(one_block_from_each_layer, cached_blocks_map);
     EXPECT_NEAR(allocator.get_used_percentage(), 1.0, 1e-5);
 
@@ -283,7 +283,7 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectlyWithPrefixCaching) {
     auto allocator = ov::genai::BlockAllocator(initial_num_free_blocks, true, num_layers);
     ASSERT_NEAR(allocator.get_used_percentage(), 0.0, 1e-5);
 
-    std::map<uint64_t, ov::genai::BlocksPerLayer> prefix_hash_map;
+    ov::genai::PrefixHashToBlocksMap prefix_hash_map;
     for (uint64_t mock_hash: {13, 42, 1337}) {
         allocator.allocate_block(mock_hash, prefix_hash_map);
     }
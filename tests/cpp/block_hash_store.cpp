@@ -3,25 +3,21 @@
 //
 
 #include <gtest/gtest.h>
+#include <deque>
 #include "openvino/runtime/core.hpp"
 #include "continuous_batching/scheduler.hpp"
-#include <chrono>
-#include <thread>
 
 TEST(TestBlockHashStore, general_test) {
     ov::genai::OverwritableBlocksHashStore block_hash_store(1);
-    auto block0 = std::make_shared<ov::genai::KVCacheBlock>(0);
-    block0->set_hash(77);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
-    auto block1 = std::make_shared<ov::genai::KVCacheBlock>(1);
-    block1->set_hash(56);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
-    auto block2 = std::make_shared<ov::genai::KVCacheBlock>(2);
-    block2->set_hash(23);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
-    block_hash_store.add(ov::genai::BlocksPerLayer{block0});
-    block_hash_store.add(ov::genai::BlocksPerLayer{block1});
-    block_hash_store.add(ov::genai::BlocksPerLayer{block2});
+    ov::genai::KVCacheBlock block0(0);
+    block0.set_hash(77);
+    ov::genai::KVCacheBlock block1(1);
+    block1.set_hash(56);
+    ov::genai::KVCacheBlock block2(2);
+    block2.set_hash(23);
+    block_hash_store.add(ov::genai::BlocksPerLayer{&block0});
+    block_hash_store.add(ov::genai::BlocksPerLayer{&block1});
+    block_hash_store.add(ov::genai::BlocksPerLayer{&block2});
     EXPECT_EQ(block_hash_store.num_blocks(), 3);
 
     auto block = block_hash_store.get_block_to_restore(56)[0];
@@ -36,19 +32,54 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 0);
     EXPECT_EQ(block_hash_store.num_blocks(), 1);
 
-    auto block3 = std::make_shared<ov::genai::KVCacheBlock>(7);
-    block3->set_hash(12);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
-    auto block4 = std::make_shared<ov::genai::KVCacheBlock>(10);
-    block4->set_hash(99);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
-    block_hash_store.add(ov::genai::BlocksPerLayer{block3});
-    block_hash_store.add(ov::genai::BlocksPerLayer{block4});
-    block2->set_timestamp(std::chrono::steady_clock::now());
+    ov::genai::KVCacheBlock block3(7);
+    block3.set_hash(12);
+    ov::genai::KVCacheBlock block4(10);
+    block4.set_hash(99);
+    block_hash_store.add(ov::genai::BlocksPerLayer{&block3});
+    block_hash_store.add(ov::genai::BlocksPerLayer{&block4});
 
+    // eviction follows the order of addition to the store
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 2);
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 7);
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 10);
-    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 2);
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, restored_and_readded_block_becomes_most_recently_used) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    std::deque<ov::genai::KVCacheBlock> blocks;
+    for (size_t hash : {5, 6, 7}) {
+        auto& block = blocks.emplace_back(blocks.size());
+        block.set_hash(hash);
+        block_hash_store.add(ov::genai::BlocksPerLayer{&block});
+    }
+
+    auto restored = block_hash_store.get_block_to_restore(5);
+    ASSERT_EQ(restored.size(), 1);
+    restored[0]->release();
+    block_hash_store.add(restored);
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 6);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 7);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 5);
+}
+
+TEST(TestBlockHashStore, clean_store_keeps_lru_order_of_remaining_blocks) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    std::deque<ov::genai::KVCacheBlock> blocks;
+    for (size_t hash : {1, 2, 3, 4}) {
+        auto& block = blocks.emplace_back(hash);
+        block.set_hash(hash);
+        block_hash_store.add(ov::genai::BlocksPerLayer{&block});
+    }
+
+    auto removed = block_hash_store.clean_store({1, 3, 42});
+    EXPECT_EQ(removed.size(), 2);
+    EXPECT_EQ(block_hash_store.num_blocks(), 2);
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 2);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 4);
+    EXPECT_EQ(block_hash_store.num_blocks(), 0);
+}
@@ -111,3 +111,91 @@ TEST(TestBlockManager, CanFreeBlocksFromSequence) {
         bm.free_sequence(sequence->get_id());
     }
 }
+
+TEST(TestBlockManager, OffloadsOverwrittenPrefixBlocksToHost) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(2, true, BLOCK_SIZE);
+    auto host_cache_store = std::make_shared<ov::genai::HostKVCacheStore>(std::vector<ov::element::Type>{ov::element::f32},
+                                                                          std::vector<ov::Shape>{{1, 1, BLOCK_SIZE, 2}},
+                                                                          std::vector<ov::element::Type>{ov::element::f32},
+                                                                          std::vector<ov::Shape>{{1, 1, BLOCK_SIZE, 2}},
+                                                                          /* max_ram_blocks = */ 4);
+    bm.set_host_cache_store(host_cache_store);
+
+    auto schedule_and_free = [&](std::vector<int64_t>& tokens, uint64_t request_id) {
+        auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(request_id,
+                                                                         ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         ov::genai::utils::get_greedy_config(),
+                                                                         BLOCK_SIZE);
+        sequence_group->schedule_tokens(tokens.size());
+        bm.append_slots(sequence_group);
+        bm.free_sequence(sequence_group->get_sequences()[0]->get_id());
+    };
+
+    std::vector<int64_t> tokens_a = {0, 1, 2, 3, 4, 5, 6, 7};
+    schedule_and_free(tokens_a, 0);
+    EXPECT_TRUE(bm.pull_host_transfers().empty());
+
+    // both blocks of the first prompt are overwritten by the second one
+    std::vector<int64_t> tokens_b = {10, 11, 12, 13, 14, 15, 16, 17};
+    schedule_and_free(tokens_b, 1);
+    auto transfers = bm.pull_host_transfers();
+    ASSERT_EQ(transfers.size(), 2);
+    for (const auto& transfer : transfers) {
+        EXPECT_EQ(transfer.direction, ov::genai::KVCacheBlockTransfer::Direction::TO_HOST);
+        host_cache_store->put(transfer.hash, host_cache_store->allocate_block());
+    }
+    EXPECT_EQ(host_cache_store->num_ram_blocks(), 2);
+
+    // the first prompt is restored from the host tier instead of being recomputed
+    auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(2,
+                                                                     ov::Tensor(ov::element::i64, {tokens_a.size()}, tokens_a.data()),
+                                                                     ov::genai::utils::get_greedy_config(),
+                                                                     BLOCK_SIZE);
+    bm.restore_cached_blocks(sequence_group);
+    EXPECT_EQ(sequence_group->get_num_processed_tokens(), tokens_a.size() - 1);
+
+    transfers = bm.pull_host_transfers();
+    ASSERT_EQ(transfers.size(), 4);
+    EXPECT_EQ(transfers[0].direction, ov::genai::KVCacheBlockTransfer::Direction::TO_HOST);
+    EXPECT_EQ(transfers[1].direction, ov::genai::KVCacheBlockTransfer::Direction::FROM_HOST);
+    EXPECT_EQ(transfers[1].block_indices, transfers[0].block_indices);
+    EXPECT_EQ(transfers[1].contents.key_blocks.size(), 1);
+    EXPECT_EQ(transfers[2].direction, ov::genai::KVCacheBlockTransfer::Direction::TO_HOST);
+    EXPECT_EQ(transfers[3].direction, ov::genai::KVCacheBlockTransfer::Direction::FROM_HOST);
+    EXPECT_EQ(host_cache_store->num_ram_blocks(), 0);
+
+    bm.free_sequence(sequence_group->get_sequences()[0]->get_id());
+}
+
+TEST(TestBlockManager, OverwritesLastBlocksOfCachedPrefixFirst) {
+    const size_t BLOCK_SIZE = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(3, true, BLOCK_SIZE);
+
+    auto schedule_and_free = [&](std::vector<int64_t>& tokens, uint64_t request_id) {
+        auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(request_id,
+                                                                         ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         ov::genai::utils::get_greedy_config(),
+                                                                         BLOCK_SIZE);
+        sequence_group->schedule_tokens(tokens.size());
+        bm.append_slots(sequence_group);
+        bm.free_sequence(sequence_group->get_sequences()[0]->get_id());
+    };
+
+    std::vector<int64_t> tokens_a = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    schedule_and_free(tokens_a, 0);
+
+    // takes a single block, which must be the last block of the cached prompt
+    std::vector<int64_t> tokens_b = {20, 21, 22, 23};
+    schedule_and_free(tokens_b, 1);
+
+    std::vector<int64_t> tokens_c = {0, 1, 2, 3, 4, 5, 6, 7, 30};
+    auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(2,
+                                                                     ov::Tensor(ov::element::i64, {tokens_c.size()}, tokens_c.data()),
+                                                                     ov::genai::utils::get_greedy_config(),
+                                                                     BLOCK_SIZE);
+    bm.restore_cached_blocks(sequence_group);
+    EXPECT_EQ(sequence_group->get_num_processed_tokens(), 2 * BLOCK_SIZE);
+
+    bm.free_sequence(sequence_group->get_sequences()[0]->get_id());
+}
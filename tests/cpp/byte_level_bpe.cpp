@@ -0,0 +1,127 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/byte_level_bpe.hpp"
+
+using namespace ov::genai;
+using SplitPattern = ByteLevelBPETokenizer::SplitPattern;
+
+namespace {
+
+// Vocabulary of single bytes and of the given words, with merges which build each word from left to right.
+// Merges joining adjacent words are added last, so they apply only if the words are not split apart.
+struct WordsVocab {
+    std::vector<std::string> vocab;
+    std::vector<std::pair<std::string, std::string>> merges;
+
+    void add_token(const std::string& token) {
+        if (std::find(vocab.begin(), vocab.end(), token) == vocab.end()) {
+            vocab.push_back(token);
+        }
+    }
+
+    explicit WordsVocab(const std::vector<std::string>& words) {
+        for (size_t byte = 0; byte < 256; ++byte) {
+            vocab.emplace_back(1, static_cast<char>(byte));
+        }
+        for (const auto& word : words) {
+            for (size_t length = 2; length <= word.size(); ++length) {
+                merges.emplace_back(word.substr(0, length - 1), word.substr(length - 1, 1));
+                add_token(word.substr(0, length));
+            }
+        }
+        for (size_t i = 0; i + 1 < words.size(); ++i) {
+            merges.emplace_back(words[i], words[i + 1]);
+            add_token(words[i] + words[i + 1]);
+        }
+    }
+
+    std::vector<std::string> split(const std::vector<SplitPattern>& patterns, const std::string& text) const {
+        ByteLevelBPETokenizer tokenizer(vocab, merges, {}, patterns, false);
+        auto tokens = tokenizer.encode(text);
+        EXPECT_TRUE(tokens.has_value());
+        std::vector<std::string> words;
+        for (int64_t token : tokens.value_or(std::vector<int64_t>{})) {
+            words.push_back(vocab.at(token));
+        }
+        return words;
+    }
+};
+
+void expect_split(const std::vector<SplitPattern>& patterns, const std::vector<std::string>& words) {
+    std::string text;
+    for (const auto& word : words) {
+        text += word;
+    }
+    EXPECT_EQ(WordsVocab(words).split(patterns, text), words) << text;
+}
+
+}  // namespace
+
+TEST(TestByteLevelBPE, find_split_pattern) {
+    EXPECT_EQ(ByteLevelBPETokenizer::find_split_pattern(R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S))"),
+              SplitPattern::GPT2);
+    EXPECT_EQ(ByteLevelBPETokenizer::find_split_pattern(R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)"),
+              SplitPattern::CL100K);
+    EXPECT_EQ(ByteLevelBPETokenizer::find_split_pattern(R"((?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)"),
+              SplitPattern::CL100K_DIGIT);
+    EXPECT_EQ(ByteLevelBPETokenizer::find_split_pattern(R"([0-9][0-9][0-9])"), SplitPattern::THREE_DIGITS);
+    EXPECT_EQ(ByteLevelBPETokenizer::find_split_pattern(R"(\p{L}+)"), std::nullopt);
+}
+
+TEST(TestByteLevelBPE, gpt2_split) {
+    expect_split({SplitPattern::GPT2}, {"Hello", " world", "'s", " ", " 123", "abc", "!!", "\n\n", " x", "'", "T", "  "});
+}
+
+TEST(TestByteLevelBPE, cl100k_split) {
+    expect_split({SplitPattern::CL100K}, {"I", "'VE", " ", " ", "123", "45", "abc", "\n\n", " ", " ,", "x", "(hello", " ...\n", "\t"});
+    expect_split({SplitPattern::CL100K_DIGIT}, {"x", "1", "2", "3", " y", " \n"});
+}
+
+TEST(TestByteLevelBPE, chained_splits) {
+    expect_split({SplitPattern::PUNCTUATION, SplitPattern::DIGIT}, {"a", ",", "b", "1", "2", "!!", "x`y"});
+    expect_split({SplitPattern::GPT2, SplitPattern::THREE_DIGITS}, {"x", " ", "123", "456", "7"});
+}
+
+TEST(TestByteLevelBPE, merges_by_rank) {
+    const std::vector<std::string> vocab = {"a", "b", "c", "ab", "bc", "aa"};
+    ByteLevelBPETokenizer tokenizer(vocab, {{"b", "c"}, {"a", "b"}, {"a", "a"}}, {}, {}, false);
+    // "bc" has the lower rank than "ab"
+    EXPECT_EQ(tokenizer.encode("abc"), (std::vector<int64_t>{0, 4}));
+    // the leftmost pair is merged first
+    EXPECT_EQ(tokenizer.encode("aaa"), (std::vector<int64_t>{5, 0}));
+    // the cached word is encoded the same
+    EXPECT_EQ(tokenizer.encode("aaa"), (std::vector<int64_t>{5, 0}));
+    // bytes without tokens cannot be encoded
+    EXPECT_EQ(tokenizer.encode("ad"), std::nullopt);
+}
+
+TEST(TestByteLevelBPE, bytes_to_chars) {
+    const auto& byte_chars = ByteLevelBPETokenizer::get_byte_chars();
+    EXPECT_EQ(byte_chars[' '], "\xc4\xa0");
+    EXPECT_EQ(byte_chars['\n'], "\xc4\x8a");
+    EXPECT_EQ(byte_chars['a'], "a");
+
+    std::vector<std::string> vocab(byte_chars.begin(), byte_chars.end());
+    vocab.push_back("\xc4\xa0" "b");
+    ByteLevelBPETokenizer tokenizer(vocab, {{"\xc4\xa0", "b"}}, {}, {SplitPattern::GPT2}, true);
+    EXPECT_EQ(tokenizer.encode("a b"), (std::vector<int64_t>{std::find(byte_chars.begin(), byte_chars.end(), "a") - byte_chars.begin(), 256}));
+}
+
+TEST(TestByteLevelBPE, added_tokens) {
+    std::vector<std::string> vocab = {"a", "b", " ", "<", ">", "x", "<x>", "<x>b"};
+    ByteLevelBPETokenizer tokenizer(vocab, {}, {{"<x>", 6}, {"<x>b", 7}}, {SplitPattern::GPT2}, false);
+    // the first of the added tokens is matched
+    EXPECT_EQ(tokenizer.encode("a<x>b <x>"), (std::vector<int64_t>{0, 6, 1, 2, 6}));
+    EXPECT_EQ(tokenizer.encode("<x"), (std::vector<int64_t>{3, 5}));
+    EXPECT_EQ(tokenizer.get_added_tokens(), (std::vector<std::string>{"<x>", "<x>b"}));
+}
+
+TEST(TestByteLevelBPE, non_ascii_text) {
+    ByteLevelBPETokenizer tokenizer(WordsVocab({}).vocab, {}, {}, {SplitPattern::GPT2}, false);
+    EXPECT_EQ(tokenizer.encode("caf\xc3\xa9"), std::nullopt);
+    EXPECT_EQ(tokenizer.encode(""), std::vector<int64_t>{});
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "llm/chat_session_pool.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ChatSessionPool::Session make_session(const ChatHistory& history, size_t num_tokens) {
+    ChatSessionPool::Session session;
+    session.history = history;
+    session.kv_cache_state.get_state().assign(num_tokens, 1);
+    session.attention_mask = ov::Tensor(ov::element::i64, {1, num_tokens});
+    // one KV cache layer of 4 bytes per token
+    session.states.emplace_back("past_key_values.0.key", ov::Tensor(ov::element::f32, {1, 1, num_tokens, 1}));
+    return session;
+}
+
+ChatHistory make_history(std::initializer_list<std::string> messages) {
+    ChatHistory history;
+    for (const auto& message : messages) {
+        history.push_back({{"role", "user"}, {"content", message}});
+    }
+    return history;
+}
+
+}  // namespace
+
+TEST(TestChatSessionPool, ResumesSessionWithLongestMatchingHistory) {
+    ChatSessionPool pool(1024);
+    pool.put(make_session(make_history({"a"}), 4));
+    pool.put(make_session(make_history({"a", "b"}), 8));
+    pool.put(make_session(make_history({"c"}), 4));
+    EXPECT_EQ(pool.size(), 3);
+
+    auto session = pool.take(make_history({"a", "b", "d"}));
+    ASSERT_TRUE(session.has_value());
+    EXPECT_EQ(session->history.size(), 2);
+    EXPECT_EQ(session->kv_cache_state.get_state().size(), 8);
+    EXPECT_EQ(pool.size(), 2);
+
+    EXPECT_FALSE(pool.take(make_history({"d"})).has_value());
+    EXPECT_FALSE(pool.take(make_history({"b", "a"})).has_value());
+    EXPECT_TRUE(pool.take(make_history({"c"})).has_value());
+    EXPECT_EQ(pool.size(), 1);
+}
+
+TEST(TestChatSessionPool, EvictsLeastRecentlySuspendedSessions) {
+    // each session of 4 tokens takes 4 * (8 + 4) bytes
+    ChatSessionPool pool(100);
+    pool.put(make_session(make_history({"a"}), 4));
+    pool.put(make_session(make_history({"b"}), 4));
+    pool.put(make_session(make_history({"c"}), 4));
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_FALSE(pool.take(make_history({"a"})).has_value());
+    EXPECT_TRUE(pool.take(make_history({"b"})).has_value());
+
+    // a session exceeding the budget alone is not kept
+    pool.put(make_session(make_history({"d"}), 16));
+    EXPECT_EQ(pool.size(), 1);
+    EXPECT_FALSE(pool.take(make_history({"d"})).has_value());
+
+    pool.clear();
+    EXPECT_EQ(pool.size(), 0);
+}
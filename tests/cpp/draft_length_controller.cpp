@@ -0,0 +1,69 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "speculative_decoding/continuous_batching/draft_length_controller.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+std::chrono::steady_clock::duration to_duration(double milliseconds) {
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(Milliseconds(milliseconds));
+}
+
+// main model step takes 10 ms plus 0.1 ms per token, draft model inference takes 1 ms
+void register_costs(DraftLengthController& controller, size_t batch_size) {
+    for (size_t num_tokens : {batch_size, 2 * batch_size, 6 * batch_size}) {
+        controller.register_main_step(num_tokens, to_duration(10.0 + 0.1 * num_tokens));
+    }
+    controller.register_draft_steps(5, batch_size, to_duration(5.0));
+}
+
+void register_acceptance(DraftLengthController& controller, uint64_t request_id, size_t num_drafted, size_t num_accepted) {
+    for (size_t step = 0; step < 20; ++step) {
+        controller.register_validation(request_id, num_drafted, num_accepted);
+    }
+}
+
+}  // namespace
+
+TEST(TestDraftLengthController, KeepsConfiguredLengthUntilMeasured) {
+    DraftLengthController controller;
+    controller.add_request(0, 5);
+    EXPECT_EQ(controller.get_draft_length(0, 1), 5);
+    register_acceptance(controller, 0, 5, 0);
+    EXPECT_EQ(controller.get_draft_length(0, 1), 5);
+}
+
+TEST(TestDraftLengthController, FollowsAcceptanceRate) {
+    DraftLengthController controller;
+    register_costs(controller, 1);
+    controller.add_request(0, 5);
+    controller.add_request(1, 5);
+    register_acceptance(controller, 0, 5, 5);
+    register_acceptance(controller, 1, 5, 0);
+    EXPECT_NEAR(controller.get_acceptance(0), 1.0, 1e-6);
+    EXPECT_NEAR(controller.get_acceptance(1), 0.0, 1e-6);
+    EXPECT_EQ(controller.get_draft_length(0, 1), 10);
+    EXPECT_EQ(controller.get_draft_length(1, 1), 1);
+}
+
+TEST(TestDraftLengthController, ShortensDraftsForLargeBatches) {
+    DraftLengthController small_batch_controller, large_batch_controller;
+    register_costs(small_batch_controller, 1);
+    register_costs(large_batch_controller, 256);
+    small_batch_controller.add_request(0, 5);
+    large_batch_controller.add_request(0, 5);
+    // 3 of 5 draft tokens are accepted at each step
+    register_acceptance(small_batch_controller, 0, 5, 3);
+    register_acceptance(large_batch_controller, 0, 5, 3);
+    size_t small_batch_length = small_batch_controller.get_draft_length(0, 1);
+    size_t large_batch_length = large_batch_controller.get_draft_length(0, 256);
+    EXPECT_GT(small_batch_length, large_batch_length);
+    EXPECT_GE(large_batch_length, 1);
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_GGUF
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+#include "gguf_utils/gguf.hpp"
+
+#if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
+#    include <tbb/task_arena.h>
+#endif
+
+namespace {
+
+struct TestTensor {
+    std::string name;
+    std::vector<uint64_t> dims;  // in the GGUF order, the innermost dimension first
+    gguf_tensor_type type;
+    uint64_t block_size;         // elements
+    uint64_t bytes_per_block;
+    uint64_t scale_offset;       // of the f16 scale within the block
+};
+
+// Writes a GGUF file with the tensors filled with random blocks, whose scales are finite.
+void write_gguf(const std::filesystem::path& path, const std::vector<TestTensor>& tensors) {
+    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_create(path.string().c_str(), GGUF_OVERWRITE), gguf_close);
+    ASSERT_TRUE(ctx);
+
+    std::vector<std::vector<uint8_t>> data;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_real_distribution<float> scale(0.001f, 0.1f);
+    uint64_t offset = 0;
+    for (const auto& tensor : tensors) {
+        uint64_t num_elements = 1;
+        for (uint64_t dim : tensor.dims) {
+            num_elements *= dim;
+        }
+        std::vector<uint8_t> bytes(num_elements / tensor.block_size * tensor.bytes_per_block);
+        for (auto& value : bytes) {
+            value = static_cast<uint8_t>(byte(generator));
+        }
+        for (size_t block = 0; block < bytes.size(); block += tensor.bytes_per_block) {
+            const uint16_t bits = ov::float16(scale(generator)).to_bits();
+            std::memcpy(bytes.data() + block + tensor.scale_offset, &bits, sizeof(bits));
+        }
+
+        offset += gguf_get_alignment_padding(ctx->alignment, offset);
+        std::vector<uint64_t> dims = tensor.dims;
+        ASSERT_TRUE(gguf_append_tensor_info(ctx.get(),
+                                            tensor.name.c_str(),
+                                            tensor.name.size(),
+                                            static_cast<uint32_t>(dims.size()),
+                                            dims.data(),
+                                            tensor.type,
+                                            offset));
+        offset += bytes.size();
+        data.push_back(std::move(bytes));
+    }
+    for (auto& bytes : data) {
+        ASSERT_TRUE(gguf_append_tensor_data(ctx.get(), bytes.data(), bytes.size()));
+    }
+}
+
+void expect_same_tensors(const std::unordered_map<std::string, ov::Tensor>& expected,
+                         const std::unordered_map<std::string, ov::Tensor>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (const auto& [name, tensor] : expected) {
+        auto it = actual.find(name);
+        ASSERT_NE(it, actual.end()) << name;
+        ASSERT_EQ(tensor.get_element_type(), it->second.get_element_type()) << name;
+        ASSERT_EQ(tensor.get_shape(), it->second.get_shape()) << name;
+        EXPECT_EQ(std::memcmp(tensor.data(), it->second.data(), tensor.get_byte_size()), 0) << name;
+    }
+}
+
+}  // namespace
+
+TEST(TestGGUF, ParallelConversionMatchesSerial) {
+#if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
+    // the tensors span several pages, so that release_tensor_pages drops some of them
+    const std::vector<TestTensor> tensors = {
+        {"blk.0.attn_q.weight", {256, 64}, GGUF_TYPE_Q8_0, 32, 34, 0},
+        {"blk.0.attn_k.weight", {128, 96}, GGUF_TYPE_Q8_0, 32, 34, 0},
+        {"blk.0.ffn_down.weight", {256, 64}, GGUF_TYPE_Q6_K, 256, 210, 208},
+        {"blk.1.ffn_down.weight", {512, 32}, GGUF_TYPE_Q6_K, 256, 210, 208},
+        {"output_norm.weight", {64, 64}, GGUF_TYPE_F16, 1, 2, 0},
+    };
+    const auto path = std::filesystem::temp_directory_path() / "ov_genai_test_parallel_conversion.gguf";
+    write_gguf(path, tensors);
+
+    GGUFLoad serial;
+    tbb::task_arena single_thread(1);
+    single_thread.execute([&] {
+        serial = get_gguf_data(path.string());
+    });
+    GGUFLoad parallel = get_gguf_data(path.string());
+    std::filesystem::remove(path);
+
+    // the weights, scales and biases of every quantized tensor and the plain tensor
+    EXPECT_EQ(std::get<1>(serial).size(), 4 * 3 + 1);
+    expect_same_tensors(std::get<1>(serial), std::get<1>(parallel));
+    EXPECT_EQ(std::get<2>(serial), std::get<2>(parallel));
+#else
+    GTEST_SKIP() << "The conversion cannot be limited to one thread without TBB";
+#endif
+}
+
+#endif  // ENABLE_GGUF
@@ -0,0 +1,98 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "tokenizer/incremental_detokenizer.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+const std::string replacement = "\xef\xbf\xbd";
+
+// decodes SentencePiece-like pieces, where "_" stands for a space which is dropped at the beginning of the text
+struct FakeDetokenizer {
+    std::vector<std::string> vocab = {"_Hello", "_world", ",", "_again", "\xe4\xbd", "\xa0", "\xff"};
+    size_t num_calls = 0;
+    size_t max_decoded_tokens = 0;
+
+    std::string operator()(const std::vector<int64_t>& tokens) {
+        ++num_calls;
+        max_decoded_tokens = std::max(max_decoded_tokens, tokens.size());
+        std::string text;
+        for (int64_t token : tokens) {
+            for (char c : vocab.at(token)) {
+                text.push_back(c == '_' ? ' ' : c);
+            }
+        }
+        if (!text.empty() && text.front() == ' ') {
+            text.erase(0, 1);
+        }
+        return text;
+    }
+};
+
+}  // namespace
+
+TEST(TestIncrementalDetokenizer, DecodesByteLevelTokensFromVocab) {
+    const std::vector<std::string> vocab = {"Hello", " world", "<s>", "\xe4\xbd", "\xa0", "\xff"};
+    const std::vector<bool> skipped_tokens = {false, false, true, false, false, false};
+    size_t num_calls = 0;
+    IncrementalDetokenizer detokenizer([&num_calls](const std::vector<int64_t>&) {
+        ++num_calls;
+        return std::string("decoded by model");
+    }, &vocab, &skipped_tokens);
+
+    std::vector<int64_t> tokens = {2, 0, 1};
+    EXPECT_EQ(detokenizer.decode(tokens), "Hello world");
+    tokens.push_back(3);
+    EXPECT_EQ(detokenizer.decode(tokens), "Hello world" + replacement);
+    tokens.push_back(4);
+    EXPECT_EQ(detokenizer.decode(tokens), "Hello world\xe4\xbd\xa0");
+    EXPECT_EQ(detokenizer.get_decoded_length(tokens, 2), 5);
+    EXPECT_EQ(detokenizer.get_decoded_length(tokens, 4), std::nullopt);
+    EXPECT_EQ(num_calls, 0);
+
+    // invalid UTF-8 is decoded by the model
+    tokens.push_back(5);
+    EXPECT_EQ(detokenizer.decode(tokens), "decoded by model");
+    EXPECT_GT(num_calls, 0);
+
+    detokenizer.reset();
+    num_calls = 0;
+    EXPECT_EQ(detokenizer.decode({0}), "Hello");
+    EXPECT_EQ(num_calls, 0);
+}
+
+TEST(TestIncrementalDetokenizer, DecodesWindowOfLastTokens) {
+    FakeDetokenizer fake;
+    IncrementalDetokenizer detokenizer([&fake](const std::vector<int64_t>& tokens) {
+        return fake(tokens);
+    });
+
+    std::vector<int64_t> tokens;
+    for (size_t i = 0; i < 200; ++i) {
+        tokens.push_back(i % 4);
+        if (i % 10 == 9) {
+            // a character split between two tokens
+            tokens.push_back(4);
+            EXPECT_EQ(detokenizer.decode(tokens), fake(tokens));
+            tokens.push_back(5);
+        }
+        EXPECT_EQ(detokenizer.decode(tokens), fake(tokens));
+        const size_t position = tokens.size() > 3 ? tokens.size() - 3 : 0;
+        std::string prefix = fake(std::vector<int64_t>(tokens.begin(), tokens.begin() + position));
+        EXPECT_EQ(detokenizer.get_decoded_length(tokens, position), prefix.size());
+    }
+
+    fake.max_decoded_tokens = 0;
+    detokenizer.reset();
+    tokens.clear();
+    for (size_t i = 0; i < 200; ++i) {
+        tokens.push_back(i % 4);
+        detokenizer.decode(tokens);
+    }
+    EXPECT_LT(fake.max_decoded_tokens, 32);
+}
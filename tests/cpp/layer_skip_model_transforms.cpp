@@ -0,0 +1,156 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/result.hpp"
+#include "speculative_decoding/layer_skip_model_transforms.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t HIDDEN_SIZE = 4, VOCAB_SIZE = 8;
+
+std::shared_ptr<ov::Node> make_weights(size_t rows, size_t columns) {
+    return ov::op::v0::Constant::create(ov::element::f32, ov::Shape{rows, columns}, std::vector<float>(rows * columns, 0.1f));
+}
+
+std::string get_variable_id(size_t layer_idx) {
+    return "past_key_values." + std::to_string(layer_idx) + ".keypresent." + std::to_string(layer_idx) + ".key";
+}
+
+// decoder with the layer structure recognized by the transformation: the attention is mimicked by a sum over the KV cache
+// and the layer output is the residual Add after the gated MLP. The KV cache is either passed through
+// past_key_values.* parameters and present.* results, or kept in ReadValue/Assign states as in stateful IRs
+std::shared_ptr<ov::Model> get_decoder_model(size_t num_layers, bool is_stateful = false) {
+    auto hidden_states = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, HIDDEN_SIZE});
+    hidden_states->get_output_tensor(0).set_names({"inputs_embeds"});
+    ov::ParameterVector parameters{hidden_states};
+    ov::ResultVector results;
+    ov::SinkVector sinks;
+    ov::op::util::VariableVector variables;
+
+    ov::Output<ov::Node> hidden = hidden_states;
+    for (size_t i = 0; i < num_layers; ++i) {
+        const std::string layer = "model.layers." + std::to_string(i);
+        ov::Output<ov::Node> past_key;
+        std::shared_ptr<ov::op::util::Variable> variable;
+        if (is_stateful) {
+            variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{ov::PartialShape{-1, -1, HIDDEN_SIZE}, ov::element::f32, get_variable_id(i)});
+            variables.push_back(variable);
+            auto initial_key = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 0, HIDDEN_SIZE}, std::vector<float>{});
+            past_key = std::make_shared<ov::op::v6::ReadValue>(initial_key, variable);
+        } else {
+            auto past_key_parameter = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, HIDDEN_SIZE});
+            past_key_parameter->get_output_tensor(0).set_names({"past_key_values." + std::to_string(i) + ".key"});
+            parameters.push_back(past_key_parameter);
+            past_key = past_key_parameter;
+        }
+
+        auto key = std::make_shared<ov::op::v0::MatMul>(hidden, make_weights(HIDDEN_SIZE, HIDDEN_SIZE));
+        auto present_key = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past_key, key}, 1);
+        if (is_stateful) {
+            sinks.push_back(std::make_shared<ov::op::v6::Assign>(present_key, variable));
+        } else {
+            present_key->get_output_tensor(0).set_names({"present." + std::to_string(i) + ".key"});
+            results.push_back(std::make_shared<ov::op::v0::Result>(present_key));
+        }
+
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+        auto attention = std::make_shared<ov::op::v1::ReduceSum>(present_key, axis, true);
+        auto attention_residual = std::make_shared<ov::op::v1::Add>(hidden, attention);
+        auto gated = std::make_shared<ov::op::v1::Multiply>(attention_residual, attention_residual);
+        auto down_proj = std::make_shared<ov::op::v0::MatMul>(gated, make_weights(HIDDEN_SIZE, HIDDEN_SIZE));
+        auto mlp_residual = std::make_shared<ov::op::v1::Add>(attention_residual, down_proj);
+        mlp_residual->set_friendly_name(layer + "/aten::add/Add_1");
+        hidden = mlp_residual;
+    }
+    auto logits = std::make_shared<ov::op::v0::MatMul>(hidden, make_weights(HIDDEN_SIZE, VOCAB_SIZE));
+    logits->get_output_tensor(0).set_names({"logits"});
+    results.insert(results.begin(), std::make_shared<ov::op::v0::Result>(logits));
+    return std::make_shared<ov::Model>(results, sinks, parameters, variables);
+}
+
+}  // namespace
+
+TEST(TestLayerSkipModelTransforms, KeepsFirstDecoderLayers) {
+    auto main_model = get_decoder_model(4);
+    auto draft_model = utils::layer_skip::create_draft_model(main_model, 2);
+
+    // the main model is not modified
+    EXPECT_EQ(main_model->get_parameters().size(), 5);
+    EXPECT_EQ(main_model->get_results().size(), 5);
+
+    ASSERT_EQ(draft_model->get_parameters().size(), 3);
+    EXPECT_NO_THROW(draft_model->input("past_key_values.1.key"));
+    EXPECT_ANY_THROW(draft_model->input("past_key_values.2.key"));
+    ASSERT_EQ(draft_model->get_results().size(), 3);
+    EXPECT_NO_THROW(draft_model->output("present.1.key"));
+    EXPECT_ANY_THROW(draft_model->output("present.2.key"));
+
+    // the LM head consumes the output of the last kept layer
+    auto lm_head = draft_model->output("logits").get_node()->get_input_node_ptr(0);
+    EXPECT_EQ(lm_head->get_input_node_ptr(0)->get_friendly_name(), "model.layers.1/aten::add/Add_1");
+    EXPECT_EQ(draft_model->output("logits").get_partial_shape(), main_model->output("logits").get_partial_shape());
+}
+
+TEST(TestLayerSkipModelTransforms, RemovesStatesOfSkippedLayers) {
+    auto main_model = get_decoder_model(4, true);
+    auto draft_model = utils::layer_skip::create_draft_model(main_model, 2);
+
+    // the main model is not modified
+    EXPECT_EQ(main_model->get_variables().size(), 4);
+    EXPECT_EQ(main_model->get_sinks().size(), 4);
+
+    EXPECT_EQ(draft_model->get_parameters().size(), 1);
+    EXPECT_EQ(draft_model->get_results().size(), 1);
+    ASSERT_EQ(draft_model->get_variables().size(), 2);
+    ASSERT_EQ(draft_model->get_sinks().size(), 2);
+    std::set<std::string> variable_ids;
+    for (const auto& variable : draft_model->get_variables()) {
+        variable_ids.insert(variable->get_info().variable_id);
+    }
+    EXPECT_EQ(variable_ids, (std::set<std::string>{get_variable_id(0), get_variable_id(1)}));
+
+    // each kept state is still read, concatenated with the new key and assigned back to the same variable
+    for (const auto& sink : draft_model->get_sinks()) {
+        auto assign = ov::as_type_ptr<ov::op::v6::Assign>(sink);
+        ASSERT_NE(assign, nullptr);
+        auto concat = assign->get_input_node_ptr(0);
+        ASSERT_TRUE(ov::is_type<ov::op::v0::Concat>(concat));
+        auto read_value = ov::as_type<ov::op::v6::ReadValue>(concat->get_input_node_ptr(0));
+        ASSERT_NE(read_value, nullptr);
+        EXPECT_EQ(read_value->get_variable(), assign->get_variable());
+    }
+    // states of the skipped layers are not read anymore
+    size_t num_read_values = 0;
+    for (const auto& node : draft_model->get_ordered_ops()) {
+        num_read_values += ov::is_type<ov::op::v6::ReadValue>(node);
+    }
+    EXPECT_EQ(num_read_values, 2);
+
+    auto lm_head = draft_model->output("logits").get_node()->get_input_node_ptr(0);
+    EXPECT_EQ(lm_head->get_input_node_ptr(0)->get_friendly_name(), "model.layers.1/aten::add/Add_1");
+    EXPECT_NO_THROW(draft_model->validate_nodes_and_infer_types());
+}
+
+TEST(TestLayerSkipModelTransforms, RejectsInvalidNumberOfLayers) {
+    auto main_model = get_decoder_model(3);
+    EXPECT_ANY_THROW(utils::layer_skip::create_draft_model(main_model, 0));
+    EXPECT_ANY_THROW(utils::layer_skip::create_draft_model(main_model, 3));
+    EXPECT_NO_THROW(utils::layer_skip::create_draft_model(main_model, 1));
+}
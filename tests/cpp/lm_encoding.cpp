@@ -0,0 +1,65 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "lm_encoding.hpp"
+#include "utils.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::vector<int64_t> to_vector(const ov::Tensor& tensor) {
+    return {tensor.data<const int64_t>(), tensor.data<const int64_t>() + tensor.get_size()};
+}
+
+}  // namespace
+
+TEST(TestRemoveCommonPadding, RemovesColumnsPaddedInAllPrompts) {
+    std::vector<int64_t> input_ids = {0, 0, 0, 5, 6, 0,
+                                      0, 0, 7, 8, 9, 0};
+    std::vector<int64_t> attention_mask = {0, 0, 0, 1, 1, 0,
+                                           0, 0, 1, 1, 1, 0};
+    auto trimmed = remove_common_padding(ov::Tensor(ov::element::i64, {2, 6}, input_ids.data()),
+                                         ov::Tensor(ov::element::i64, {2, 6}, attention_mask.data()));
+    EXPECT_EQ(trimmed.input_ids.get_shape(), (ov::Shape{2, 3}));
+    EXPECT_EQ(to_vector(trimmed.input_ids), (std::vector<int64_t>{0, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(to_vector(trimmed.attention_mask), (std::vector<int64_t>{0, 1, 1, 1, 1, 1}));
+}
+
+TEST(TestRemoveCommonPadding, KeepsPromptsWithoutCommonPadding) {
+    std::vector<int64_t> input_ids = {0, 5, 7, 8};
+    std::vector<int64_t> attention_mask = {0, 1, 1, 1};
+    ov::Tensor input_ids_tensor(ov::element::i64, {2, 2}, input_ids.data());
+    auto trimmed = remove_common_padding(input_ids_tensor, ov::Tensor(ov::element::i64, {2, 2}, attention_mask.data()));
+    EXPECT_EQ(trimmed.input_ids.data(), input_ids_tensor.data());
+}
+
+TEST(TestGetNextBeamIdx, DropsRowsOfFinishedRequests) {
+    std::vector<int64_t> prompt = {1, 2};
+    ov::Tensor prompt_ids(ov::element::i64, {1, prompt.size()}, prompt.data());
+    auto greedy = std::make_shared<SequenceGroup>(0, prompt_ids, utils::get_greedy_config(), 32);
+    auto beam_search = std::make_shared<SequenceGroup>(1, prompt_ids, utils::get_beam_search_config(), 32);
+    Sequence::Ptr first_beam = beam_search->get_running_sequences().at(0);
+    Sequence::Ptr second_beam = beam_search->fork_sequence(first_beam);
+
+    // the previous inference has had the greedy request in row 0 and the beams in rows 1 and 2
+    std::map<size_t, size_t> beam_offsets = {{0, 0}, {1, 1}};
+
+    // both beams continue from the second beam, the greedy request is finished
+    std::map<size_t, std::map<size_t, int32_t>> beam_idxs = {
+        {1, {{first_beam->get_id(), 1}, {second_beam->get_id(), 1}}},
+    };
+    greedy->get_running_sequences().at(0)->set_status(SequenceStatus::FINISHED);
+    EXPECT_EQ(get_next_beam_idx({beam_search}, beam_idxs, beam_offsets), (std::vector<int32_t>{2, 2}));
+    EXPECT_EQ(beam_offsets, (std::map<size_t, size_t>{{1, 0}}));
+
+    // the beams are in rows 0 and 1 of the shrunk batch now
+    beam_idxs = {
+        {1, {{first_beam->get_id(), 0}, {second_beam->get_id(), 1}}},
+    };
+    EXPECT_EQ(get_next_beam_idx({beam_search}, beam_idxs, beam_offsets), (std::vector<int32_t>{0, 1}));
+    EXPECT_EQ(beam_offsets, (std::map<size_t, size_t>{{1, 0}}));
+}
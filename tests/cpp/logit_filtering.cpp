@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 #include <openvino/core/except.hpp>
+#include <random>
 
 #include "sampling/logit_processor.hpp"
 
@@ -128,6 +129,107 @@ TEST(TopKFilteringTest, FilterNotAppliedTopKGreaterThanInputSize) {
     }
 }
 
+namespace {
+
+// a softmax-normalized vocabulary with a long tail of small probabilities, as produced by LLMs
+std::vector<float> get_vocabulary_probabilities(size_t vocab_size) {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> probs(vocab_size);
+    for (auto& prob : probs) {
+        prob = dist(rng);
+    }
+    auto logits = Logits(probs.data(), probs.size());
+    TemperatureLogitTransform(0.7).apply(logits);
+    return probs;
+}
+
+std::vector<Token> get_sorted_tokens(const std::vector<float>& probs) {
+    std::vector<Token> tokens;
+    for (size_t i = 0; i < probs.size(); i++) {
+        tokens.emplace_back(probs[i], i);
+    }
+    std::sort(tokens.begin(), tokens.end(), [](const Token& lhs, const Token& rhs) { return lhs.m_log_prob > rhs.m_log_prob; });
+    return tokens;
+}
+
+}  // namespace
+
+TEST(TopKFilteringTest, LargeVocabularyResultEqualToFullSort) {
+    auto probs = get_vocabulary_probabilities(150001);
+    auto reference = get_sorted_tokens(probs);
+    for (size_t top_k : {1, 50, 1000}) {
+        auto logits = Logits(probs.data(), probs.size());
+        TopKFilter(top_k).apply(logits);
+        ASSERT_EQ(logits.m_vector.size(), top_k);
+        for (size_t i = 0; i < top_k; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, reference[i].m_log_prob);
+        }
+    }
+}
+
+TEST(TopPFilteringTest, LargeVocabularyResultEqualToFullSort) {
+    auto probs = get_vocabulary_probabilities(150001);
+    auto reference = get_sorted_tokens(probs);
+    for (float top_p : {0.1f, 0.5f, 0.9f, 0.99f}) {
+        size_t nucleus_size = 0;
+        float probability_sum = 0.0f;
+        while (probability_sum <= top_p) {
+            probability_sum += reference[nucleus_size++].m_log_prob;
+        }
+        auto logits = Logits(probs.data(), probs.size());
+        TopPFilter(top_p).apply(logits);
+        ASSERT_EQ(logits.m_size, nucleus_size);
+        for (size_t i = 0; i < nucleus_size; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, reference[i].m_log_prob);
+        }
+    }
+}
+
+TEST(TopPFilteringTest, LargeVocabularyTopPNotLessThanTotalMassKeepsAllTokens) {
+    auto probs = get_vocabulary_probabilities(151936);
+    auto reference = get_sorted_tokens(probs);
+    for (float top_p : {0.99999f, 0.9999999f, 1.0f}) {
+        auto logits = Logits(probs.data(), probs.size());
+        TopPFilter(top_p).apply(logits);
+        ASSERT_GT(logits.m_size, 0);
+        float probability_sum = 0.0f;
+        for (size_t i = 0; i < logits.m_size; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, reference[i].m_log_prob);
+            probability_sum += logits.m_vector[i].m_log_prob;
+        }
+        EXPECT_TRUE(probability_sum > top_p || logits.m_size == probs.size());
+    }
+
+    auto logits = Logits(probs.data(), probs.size());
+    TopPFilter(1.0f).apply(logits);
+    ASSERT_EQ(logits.m_size, probs.size());
+}
+
+TEST(TemperatureTransformTest, LargeVocabularyResultEqualToReference) {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> logits_data(150001);
+    for (auto& logit : logits_data) {
+        logit = dist(rng);
+    }
+    logits_data[7] = -std::numeric_limits<float>::infinity();
+
+    std::vector<double> expected(logits_data.size());
+    double max_logit = *std::max_element(logits_data.begin(), logits_data.end()), norm_sum = 0.0;
+    for (size_t i = 0; i < logits_data.size(); i++) {
+        expected[i] = std::exp((logits_data[i] - max_logit) / 0.7);
+        norm_sum += expected[i];
+    }
+
+    auto logits = Logits(logits_data.data(), logits_data.size());
+    TemperatureLogitTransform(0.7).apply(logits);
+    EXPECT_EQ(logits_data[7], 0.0f);
+    for (size_t i = 0; i < logits_data.size(); i++) {
+        EXPECT_NEAR(logits_data[i], expected[i] / norm_sum, 1e-4 * expected[i] / norm_sum + 1e-12);
+    }
+}
+
 struct RepetitionPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
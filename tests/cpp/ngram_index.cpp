@@ -0,0 +1,94 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "prompt_lookup/ngram_index.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// candidate generation of prompt lookup before the n-gram index, which rescans the whole sequence
+std::vector<int64_t> find_continuation_by_scan(const std::vector<int64_t>& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+    const size_t input_length = input_ids.size();
+    if (max_ngram_size >= input_length) {
+        max_ngram_size = input_length / 2;
+    }
+    for (size_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
+        for (size_t input_i = 0; input_i + ngram_size < input_length; input_i++) {
+            if (!std::equal(input_ids.end() - ngram_size, input_ids.end(), input_ids.begin() + input_i)) {
+                continue;
+            }
+            size_t start_candidate_idx = input_i + ngram_size;
+            size_t available_num_pred = std::min(input_length - start_candidate_idx, num_pred_tokens);
+            return {input_ids.begin() + start_candidate_idx, input_ids.begin() + start_candidate_idx + available_num_pred};
+        }
+    }
+    return {};
+}
+
+}  // namespace
+
+TEST(TestNGramIndex, MatchesFullScan) {
+    std::mt19937 rng(42);
+    for (size_t max_ngram_size : {1, 3, 5}) {
+        for (size_t vocab_size : {2, 5, 50}) {
+            std::uniform_int_distribution<int64_t> token_distribution(0, vocab_size - 1);
+            std::vector<int64_t> prompt(100);
+            for (auto& token : prompt) {
+                token = token_distribution(rng);
+            }
+
+            NGramIndex index(max_ngram_size);
+            std::vector<int64_t> generated, full_input_ids = prompt;
+            for (size_t step = 0; step < 100; ++step) {
+                // a few tokens are accepted at each step, as with speculative validation
+                for (size_t i = 0; i < step % 3 + 1; ++i) {
+                    generated.push_back(token_distribution(rng));
+                    full_input_ids.push_back(generated.back());
+                }
+                index.update(prompt, generated);
+                ASSERT_EQ(index.size(), full_input_ids.size());
+                ASSERT_EQ(index.find_continuation(4), find_continuation_by_scan(full_input_ids, 4, max_ngram_size))
+                    << "max_ngram_size " << max_ngram_size << ", vocab_size " << vocab_size << ", step " << step;
+            }
+        }
+    }
+}
+
+TEST(TestNGramIndex, ShortSequences) {
+    NGramIndex index(3);
+    index.update({}, {7});
+    EXPECT_TRUE(index.find_continuation(2).empty());
+    index.update({}, {7, 7});
+    EXPECT_EQ(index.find_continuation(2), (std::vector<int64_t>{7}));
+    EXPECT_TRUE(index.find_continuation(0).empty());
+}
+
+TEST(TestNGramIndex, PrefersMostRecentContinuation) {
+    const std::vector<int64_t> prompt = {1, 2, 3, 9, 1, 2, 4, 9, 1, 2};
+    NGramIndex first_index(2), recent_index(2, NGramIndex::MatchPolicy::MOST_RECENT);
+    first_index.update(prompt, {});
+    recent_index.update(prompt, {});
+    EXPECT_EQ(first_index.find_continuation(2), (std::vector<int64_t>{3, 9}));
+    EXPECT_EQ(recent_index.find_continuation(2), (std::vector<int64_t>{4, 9}));
+}
+
+TEST(TestNGramIndex, ReindexesReplacedTokens) {
+    const std::vector<int64_t> prompt = {1, 2, 3, 4};
+    NGramIndex index(2);
+    index.update(prompt, {5, 1});
+    EXPECT_EQ(index.find_continuation(3), (std::vector<int64_t>{2, 3, 4}));
+
+    // the last generated token is replaced
+    index.update(prompt, {5, 3});
+    EXPECT_EQ(index.size(), 6);
+    EXPECT_EQ(index.find_continuation(2), (std::vector<int64_t>{4, 5}));
+}
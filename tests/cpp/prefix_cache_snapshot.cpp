@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "continuous_batching/prefix_cache_snapshot.hpp"
+
+namespace {
+
+ov::genai::PrefixCacheSnapshotHeader get_test_header() {
+    ov::genai::PrefixCacheSnapshotHeader header;
+    header.model_fingerprint = 42;
+    header.block_size = 4;
+    header.hash_function_probe = ov::genai::get_prefix_hash_function_probe();
+    header.key_precisions = {ov::element::f32, ov::element::f32};
+    header.value_precisions = {ov::element::f32, ov::element::f32};
+    header.key_shapes = {{1, 2, 4, 8}, {1, 2, 4, 8}};
+    header.value_shapes = {{1, 2, 4, 8}, {1, 2, 4, 8}};
+    return header;
+}
+
+ov::genai::HostKVCacheStore create_store(const ov::genai::PrefixCacheSnapshotHeader& header) {
+    return ov::genai::HostKVCacheStore(header.key_precisions, header.key_shapes, header.value_precisions, header.value_shapes,
+                                       /* max_ram_blocks = */ 16);
+}
+
+void fill_block(ov::genai::HostKVCacheBlock& block, float value) {
+    for (auto& tensor : block.key_blocks) {
+        std::fill_n(tensor.data<float>(), tensor.get_size(), value);
+    }
+    for (auto& tensor : block.value_blocks) {
+        std::fill_n(tensor.data<float>(), tensor.get_size(), -value);
+    }
+}
+
+}  // namespace
+
+TEST(TestPrefixCacheSnapshot, RoundTripsBlocksIntoHostStore) {
+    auto header = get_test_header();
+    auto path = std::filesystem::temp_directory_path() / "ov_genai_test_prefix_cache_snapshot.bin";
+
+    auto source_store = create_store(header);
+    ov::genai::PrefixCacheSnapshotWriter writer(path, header);
+    for (size_t hash : {11, 22, 33}) {
+        auto block = source_store.allocate_block();
+        fill_block(block, static_cast<float>(hash));
+        writer.write_block(hash, block);
+    }
+    writer.finalize();
+
+    ov::genai::PrefixCacheSnapshotReader reader(path);
+    EXPECT_EQ(reader.get_header(), header);
+    EXPECT_EQ(reader.get_num_blocks(), 3);
+
+    auto target_store = create_store(header);
+    EXPECT_EQ(reader.read_blocks(target_store), 3);
+    EXPECT_EQ(target_store.num_ram_blocks(), 3);
+    for (size_t hash : {11, 22, 33}) {
+        auto block = target_store.take(hash);
+        ASSERT_TRUE(block.has_value());
+        EXPECT_EQ(block->key_blocks[1].data<float>()[5], static_cast<float>(hash));
+        EXPECT_EQ(block->value_blocks[0].data<float>()[7], -static_cast<float>(hash));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(TestPrefixCacheSnapshot, HeaderMismatchIsDetected) {
+    auto header = get_test_header();
+    auto path = std::filesystem::temp_directory_path() / "ov_genai_test_prefix_cache_snapshot_header.bin";
+
+    ov::genai::PrefixCacheSnapshotWriter writer(path, header);
+    writer.finalize();
+
+    ov::genai::PrefixCacheSnapshotReader reader(path);
+    auto other_model_header = header;
+    other_model_header.model_fingerprint = 43;
+    EXPECT_NE(reader.get_header(), other_model_header);
+    auto other_layout_header = header;
+    other_layout_header.key_shapes[0] = {1, 2, 8, 8};
+    EXPECT_NE(reader.get_header(), other_layout_header);
+
+    std::filesystem::remove(path);
+}
+
+TEST(TestPrefixCacheSnapshot, RejectsForeignFiles) {
+    auto path = std::filesystem::temp_directory_path() / "ov_genai_test_not_a_snapshot.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "definitely not a snapshot";
+    }
+    EXPECT_THROW(ov::genai::PrefixCacheSnapshotReader reader(path), ov::Exception);
+    std::filesystem::remove(path);
+}
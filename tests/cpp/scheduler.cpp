@@ -1111,3 +1111,306 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 }
+
+TEST(TestScheduler, cache_aware_admission_prefers_cached_prompts) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    scheduler_config.admission_policy = AdmissionPolicy::CACHE_AWARE;
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // fill the prefix cache
+    std::vector<uint64_t> cached_tokens = {0,1,2,3,4,5,6,7};
+    SequenceGroup::Ptr cached_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {cached_tokens.size()}, cached_tokens.data()),
+                                                                      utils::get_greedy_config(), 4);
+    scheduler.restore_cached_blocks(cached_group);
+    std::vector<SequenceGroup::Ptr> requests = {cached_group};
+    auto out0 = scheduler.schedule(requests);
+    EXPECT_EQ(out0.m_total_num_scheduled_tokens, cached_tokens.size());
+    cached_group->finish_iteration();
+    cached_group->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence((*cached_group)[0]->get_id());
+
+    std::vector<uint64_t> uncached_tokens = {10,11,12,13,14,15,16,17};
+    std::vector<uint64_t> extended_tokens = {0,1,2,3,4,5,6,7,8,9,10,11};
+    SequenceGroup::Ptr uncached_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {uncached_tokens.size()}, uncached_tokens.data()),
+                                                                        utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr extended_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {extended_tokens.size()}, extended_tokens.data()),
+                                                                        utils::get_greedy_config(), 4);
+    scheduler.restore_cached_blocks(uncached_group);
+    scheduler.restore_cached_blocks(extended_group);
+    EXPECT_EQ(extended_group->get_num_processed_tokens(), 8);
+
+    // the request with a prefix cache hit is admitted first, although it arrived later
+    requests = {uncached_group, extended_group};
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(requests[0], extended_group);
+    EXPECT_EQ(requests[1], uncached_group);
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1}));
+    EXPECT_EQ(extended_group->get_num_scheduled_tokens(), 4);
+    EXPECT_EQ(uncached_group->get_num_scheduled_tokens(), 4);
+    extended_group->get_running_sequences()[0]->append_token(23, 0.7);
+    for (auto& request : requests) {
+        request->finish_iteration();
+    }
+
+    // admitted requests keep their order
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(requests[0], extended_group);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 5);
+}
+
+TEST(TestScheduler, cache_aware_admission_defers_requests_with_shared_prefix) {
+    std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).max_num_batched_tokens = 32;
+    configs.at(0).num_kv_blocks = 100;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(0).max_num_seqs = 5;
+    configs.at(0).enable_prefix_caching = true;
+    configs.at(0).admission_policy = AdmissionPolicy::CACHE_AWARE;
+    configs.at(1).max_num_batched_tokens = 32;
+    configs.at(1).num_kv_blocks = 100;
+    configs.at(1).dynamic_split_fuse = true;
+    configs.at(1).max_num_seqs = 5;
+    configs.at(1).enable_prefix_caching = true;
+    configs.at(1).admission_policy = AdmissionPolicy::CACHE_AWARE;
+    for (auto scheduler_config: configs) {
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                             utils::get_greedy_config(), 4);
+        SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                             utils::get_greedy_config(), 4);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+        for (auto& request : requests) {
+            scheduler.restore_cached_blocks(request);
+        }
+
+        // only the first request computes the shared prefix
+        auto out1 = scheduler.schedule(requests);
+        EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size());
+        EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+        sequence_group1->get_running_sequences()[0]->append_token(23, 0.7);
+        for (auto& request : requests) {
+            request->finish_iteration();
+        }
+
+        // the second request restores the computed prefix and schedules only the last prompt token
+        auto out2 = scheduler.schedule(requests);
+        EXPECT_EQ(sequence_group2->get_num_processed_tokens(), tokens.size() - 1);
+        EXPECT_EQ(sequence_group2->get_num_scheduled_tokens(), 1);
+        EXPECT_EQ(out2.m_total_num_scheduled_tokens, scheduler_config.dynamic_split_fuse ? 2 : 1);
+    }
+}
+
+TEST(TestScheduler, cache_aware_admission_does_not_defer_aged_requests) {
+    const size_t block_size = 4, max_wait_steps = 2;
+    auto block_manager = std::make_shared<BlockManager>(100, true, block_size, 1);
+    CacheAwareAdmissionPolicy policy(block_manager, max_wait_steps);
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         utils::get_greedy_config(), block_size);
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         utils::get_greedy_config(), block_size);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    policy.order(requests);
+    EXPECT_FALSE(policy.is_deferred(sequence_group1));
+    policy.on_prompt_scheduled(sequence_group1);
+    EXPECT_TRUE(policy.is_deferred(sequence_group2));
+
+    // the first request is still in its prompt phase
+    policy.order(requests);
+    EXPECT_TRUE(policy.is_deferred(sequence_group2));
+    policy.order(requests);
+    EXPECT_FALSE(policy.is_deferred(sequence_group2));
+}
+
+TEST(TestScheduler, prompts_are_scheduled_by_priority_and_deadline) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = false;
+    scheduler_config.max_num_seqs = 5;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto bulk_config = utils::get_greedy_config();
+    auto deadline_config = utils::get_greedy_config();
+    deadline_config.ttft_deadline_ms = 60000;
+    auto interactive_config = utils::get_greedy_config();
+    interactive_config.priority = 1;
+    SequenceGroup::Ptr bulk_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                    bulk_config, 4);
+    SequenceGroup::Ptr deadline_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                        deadline_config, 4);
+    SequenceGroup::Ptr interactive_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                           interactive_config, 4);
+    std::vector<SequenceGroup::Ptr> requests = {bulk_group, deadline_group, interactive_group};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // only a single prompt fits into the batch
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(requests, std::vector<SequenceGroup::Ptr>({interactive_group, deadline_group, bulk_group}));
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+    interactive_group->get_running_sequences()[0]->append_token(23, 0.7);
+    interactive_group->finish_iteration();
+
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(requests, std::vector<SequenceGroup::Ptr>({interactive_group, deadline_group, bulk_group}));
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({1}));
+}
+
+TEST(TestScheduler, admitted_groups_are_not_reordered_by_deadline_slack) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto relaxed_config = utils::get_greedy_config();
+    relaxed_config.tpot_deadline_ms = 60000;
+    auto urgent_config = utils::get_greedy_config();
+    urgent_config.tpot_deadline_ms = 1;
+    SequenceGroup::Ptr relaxed_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                       relaxed_config, 4);
+    SequenceGroup::Ptr urgent_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                      urgent_config, 4);
+    std::vector<SequenceGroup::Ptr> requests = {relaxed_group, urgent_group};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    for (size_t step = 0; step < 3; ++step) {
+        scheduler.schedule(requests);
+        // the urgent group has less slack after each step, but both groups are already admitted
+        EXPECT_EQ(requests, std::vector<SequenceGroup::Ptr>({relaxed_group, urgent_group}));
+        for (auto& request : requests) {
+            request->get_running_sequences()[0]->append_token(23, 0.7);
+            request->finish_iteration();
+        }
+    }
+}
+
+TEST(TestScheduler, lower_priority_groups_are_preempted_first) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 4;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto interactive_config = utils::get_greedy_config();
+    interactive_config.priority = 1;
+    SequenceGroup::Ptr bulk_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                    utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr interactive_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                           interactive_config, 4);
+    std::vector<SequenceGroup::Ptr> requests = {bulk_group, interactive_group};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // both prompts occupy the whole KV cache
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 2 * tokens.size());
+    for (auto& request : requests) {
+        request->get_running_sequences()[0]->append_token(23, 0.7);
+        request->finish_iteration();
+    }
+
+    // the group added first is preempted, since it has lower priority
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(requests[0], interactive_group);
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+    EXPECT_EQ(interactive_group->get_num_scheduled_tokens(), 1);
+    EXPECT_LT(bulk_group->get_num_processed_tokens(), tokens.size());
+}
+
+TEST(TestScheduler, preempted_group_is_swapped_out_and_resumed) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 4;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.swap_space = 1;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         utils::get_greedy_config(), 4);
+    auto seq_id1 = (*sequence_group1)[0]->get_id();
+    auto seq_id2 = (*sequence_group2)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+    // partial preemption is disabled, so that the whole group is preempted
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config, 1, false);
+
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 2 * tokens.size());
+    for (auto& request : requests) {
+        request->get_running_sequences()[0]->append_token(23, 0.7);
+        request->finish_iteration();
+    }
+
+    // the second group is swapped out instead of being recomputed
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+    EXPECT_FALSE(scheduler.has_block_table(seq_id2));
+    EXPECT_EQ(sequence_group2->get_num_processed_tokens(), tokens.size());
+    sequence_group1->get_running_sequences()[0]->append_token(16, 0.9);
+    sequence_group1->finish_iteration();
+
+    // the second group is still swapped out while the first one occupies the KV cache
+    auto out3 = scheduler.schedule(requests);
+    EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+    sequence_group1->finish_iteration();
+
+    // after the first group has finished, the second one is swapped back in and continues generation
+    sequence_group1->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(seq_id1);
+    clear_finished_sequences(requests);
+    auto out4 = scheduler.schedule(requests);
+    EXPECT_EQ(out4.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+    EXPECT_EQ(out4.m_total_num_scheduled_tokens, 1);
+    EXPECT_TRUE(scheduler.has_block_table(seq_id2));
+    EXPECT_EQ(scheduler.get_block_tables(seq_id2)[0].size(), 3);
+}
+
+TEST(TestScheduler, group_with_most_deadline_slack_is_preempted_first) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto relaxed_config = utils::get_greedy_config();
+    relaxed_config.tpot_deadline_ms = 60000;
+    auto urgent_config = utils::get_greedy_config();
+    urgent_config.tpot_deadline_ms = 1;
+    SequenceGroup::Ptr first_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                     utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr relaxed_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                       relaxed_config, 4);
+    SequenceGroup::Ptr urgent_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                      urgent_config, 4);
+    std::vector<SequenceGroup::Ptr> requests = {first_group, relaxed_group, urgent_group};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // the prompts occupy the whole KV cache
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, 3 * tokens.size());
+    for (auto& request : requests) {
+        request->get_running_sequences()[0]->append_token(23, 0.7);
+        request->finish_iteration();
+    }
+
+    // the groups keep their order, but the relaxed group is preempted instead of the last one, since its deadline is
+    // further away
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(requests, std::vector<SequenceGroup::Ptr>({first_group, relaxed_group, urgent_group}));
+    EXPECT_EQ(first_group->get_num_scheduled_tokens(), 1);
+    EXPECT_LT(relaxed_group->get_num_processed_tokens(), tokens.size());
+    EXPECT_EQ(urgent_group->get_num_processed_tokens(), tokens.size());
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "lora/shared_file_content_cache.hpp"
+
+using ov::genai::utils::SharedFileContentCache;
+
+namespace {
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+}  // namespace
+
+TEST(TestSharedFileContentCache, SharesContentWhileHeld) {
+    auto path = std::filesystem::temp_directory_path() / "ov_genai_test_shared_adapter.safetensors";
+    write_file(path, "adapter");
+
+    SharedFileContentCache<std::string> cache;
+    size_t num_loads = 0;
+    auto load = [&num_loads](const std::filesystem::path& path) {
+        ++num_loads;
+        return read_file(path);
+    };
+
+    // the same file loaded twice, also through another path to it, is loaded once
+    auto first = cache.get(path, load);
+    auto second = cache.get(path.parent_path() / "." / path.filename(), load);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(*first, "adapter");
+    EXPECT_EQ(num_loads, 1);
+    EXPECT_EQ(cache.size(), 1);
+
+    // the content is freed with its last user
+    std::weak_ptr<const std::string> content = first;
+    first.reset();
+    EXPECT_FALSE(content.expired());
+    second.reset();
+    EXPECT_TRUE(content.expired());
+    EXPECT_EQ(cache.size(), 0);
+
+    auto third = cache.get(path, load);
+    EXPECT_EQ(num_loads, 2);
+    EXPECT_EQ(*third, "adapter");
+
+    std::filesystem::remove(path);
+}
+
+TEST(TestSharedFileContentCache, LoadsReplacedFileAgain) {
+    auto path = std::filesystem::temp_directory_path() / "ov_genai_test_replaced_adapter.safetensors";
+    write_file(path, "adapter");
+
+    SharedFileContentCache<std::string> cache;
+    auto load = [](const std::filesystem::path& path) {
+        return read_file(path);
+    };
+    auto original = cache.get(path, load);
+
+    // a different size identifies the file as replaced even if its modification time is not updated
+    write_file(path, "replaced adapter");
+    auto replaced = cache.get(path, load);
+    EXPECT_NE(original, replaced);
+    EXPECT_EQ(*original, "adapter");
+    EXPECT_EQ(*replaced, "replaced adapter");
+    EXPECT_EQ(cache.size(), 2);
+
+    std::filesystem::remove(path);
+}
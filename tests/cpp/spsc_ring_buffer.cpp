@@ -0,0 +1,113 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "spsc_ring_buffer.hpp"
+#include "generation_stream.hpp"
+
+using namespace ov::genai;
+
+TEST(TestSPSCRingBuffer, PushesAllItemsOrNone) {
+    SPSCRingBuffer<int> buffer(3);
+    EXPECT_EQ(buffer.capacity(), 4);
+
+    EXPECT_TRUE(buffer.try_push(3, [](size_t i) { return static_cast<int>(i); }));
+    EXPECT_FALSE(buffer.try_push(2, [](size_t i) { return static_cast<int>(i); }));
+    EXPECT_EQ(buffer.get_push_position(), 3);
+
+    std::vector<int> items;
+    EXPECT_EQ(buffer.consume(2, [&](int item) { items.push_back(item); }), 2);
+    EXPECT_EQ(buffer.get_consume_position(), 2);
+    EXPECT_TRUE(buffer.try_push(2, [](size_t i) { return static_cast<int>(i) + 3; }));
+    EXPECT_EQ(buffer.consume(std::numeric_limits<size_t>::max(), [&](int item) { items.push_back(item); }), 3);
+    EXPECT_EQ(items, std::vector<int>({0, 1, 2, 3, 4}));
+    EXPECT_FALSE(buffer.has_items());
+}
+
+TEST(TestSPSCRingBuffer, PassesItemsBetweenThreadsInOrder) {
+    constexpr size_t num_items = 10000;
+    SPSCRingBuffer<size_t> buffer(16);
+    std::thread producer([&buffer] {
+        for (size_t position = 0; position < num_items;) {
+            const size_t count = std::min<size_t>(1 + position % 5, num_items - position);
+            if (buffer.try_push(count, [position](size_t i) { return position + i; })) {
+                position += count;
+            }
+        }
+    });
+    size_t expected = 0;
+    while (expected < num_items) {
+        buffer.consume(std::numeric_limits<size_t>::max(), [&expected](size_t item) {
+            EXPECT_EQ(item, expected);
+            ++expected;
+        });
+    }
+    producer.join();
+}
+
+TEST(TestGenerationStream, ReadsTokensAndOutputsInOrderOfPushing) {
+    auto stream = GenerationStream::create();
+    std::vector<int64_t> ids(100);
+    std::vector<float> log_probs(100);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = static_cast<int64_t>(i);
+        log_probs[i] = -static_cast<float>(i);
+    }
+    stream->push_tokens(0, ids.data(), log_probs.data(), 10, -1.0f, GenerationFinishReason::NONE);
+    // does not fit into the ring buffer and is queued
+    stream->push_tokens(0, ids.data() + 10, log_probs.data() + 10, 80, -2.0f, GenerationFinishReason::NONE);
+    stream->push_tokens(0, ids.data() + 90, log_probs.data() + 90, 10, -3.0f, GenerationFinishReason::LENGTH);
+    stream->push({});
+
+    GenerationOutputs outputs = stream->read();
+    ASSERT_EQ(outputs.size(), 1);
+    EXPECT_EQ(outputs[0].generated_ids, ids);
+    EXPECT_EQ(outputs[0].generated_log_probs, log_probs);
+    EXPECT_EQ(outputs[0].score, -3.0f);
+    EXPECT_EQ(outputs[0].finish_reason, GenerationFinishReason::LENGTH);
+    EXPECT_FALSE(stream->can_read());
+}
+
+TEST(TestGenerationStream, ReusesOutputsForAvailableResults) {
+    auto stream = GenerationStream::create();
+    GenerationOutputs outputs;
+    EXPECT_FALSE(stream->read_available(outputs));
+
+    const int64_t ids[] = {1, 2, 3};
+    const float log_probs[] = {-1.0f, -2.0f, -3.0f};
+    stream->push_tokens(7, ids, log_probs, 2, -3.0f, GenerationFinishReason::NONE);
+    ASSERT_TRUE(stream->read_available(outputs));
+    EXPECT_EQ(outputs[7].generated_ids, std::vector<int64_t>({1, 2}));
+
+    stream->push_tokens(7, ids + 2, log_probs + 2, 1, -6.0f, GenerationFinishReason::STOP);
+    ASSERT_TRUE(stream->read_available(outputs));
+    EXPECT_EQ(outputs.size(), 1);
+    EXPECT_EQ(outputs[7].generated_ids, std::vector<int64_t>({3}));
+    EXPECT_EQ(outputs[7].generated_log_probs, std::vector<float>({-3.0f}));
+    EXPECT_EQ(outputs[7].score, -6.0f);
+    EXPECT_EQ(outputs[7].finish_reason, GenerationFinishReason::STOP);
+}
+
+TEST(TestGenerationStream, WakesUpWaitingReader) {
+    auto stream = GenerationStream::create();
+    constexpr size_t num_tokens = 10000;
+    std::thread producer([&stream] {
+        for (size_t i = 0; i < num_tokens; ++i) {
+            const int64_t id = static_cast<int64_t>(i);
+            const float log_prob = 0.0f;
+            stream->push_tokens(0, &id, &log_prob, 1, 0.0f, GenerationFinishReason::NONE);
+        }
+    });
+    GenerationOutputs outputs;
+    while (outputs[0].generated_ids.size() < num_tokens) {
+        stream->read_into(outputs);
+    }
+    producer.join();
+    for (size_t i = 0; i < num_tokens; ++i) {
+        ASSERT_EQ(outputs[0].generated_ids[i], static_cast<int64_t>(i));
+    }
+}
@@ -0,0 +1,133 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "sampling/stop_string_matcher.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// decodes SentencePiece-like pieces, where "_" stands for a space which is dropped at the beginning of the text
+struct FakeDetokenizer {
+    std::map<int64_t, std::string> vocab = {
+        {0, "Hello"}, {1, "_world"}, {2, "_STOP"}, {3, "!"}, {4, "_again"}, {5, "\n"}, {6, "ST"}, {7, "OP"},
+    };
+    size_t num_calls = 0;
+    size_t max_decoded_tokens = 0;
+
+    std::string operator()(std::vector<int64_t>::const_iterator begin, std::vector<int64_t>::const_iterator end) {
+        ++num_calls;
+        max_decoded_tokens = std::max(max_decoded_tokens, static_cast<size_t>(end - begin));
+        std::string text;
+        for (auto it = begin; it != end; ++it) {
+            for (char c : vocab.at(*it)) {
+                text.push_back(c == '_' ? ' ' : c);
+            }
+        }
+        return !text.empty() && text.front() == ' ' ? text.substr(1) : text;
+    }
+};
+
+}  // namespace
+
+TEST(TestStopStringAutomaton, FindsOverlappingStopStrings) {
+    StopStringAutomaton automaton({"he", "she", "his", "hers"});
+    EXPECT_EQ(automaton.get_max_length(), 4);
+
+    const std::string text = "ushers";
+    std::vector<size_t> match_lengths;
+    auto state = StopStringAutomaton::INITIAL_STATE;
+    for (char c : text) {
+        state = automaton.next(state, static_cast<uint8_t>(c));
+        match_lengths.push_back(automaton.get_match_length(state));
+    }
+    // "she" and "he" end at the 4th byte, the longest one is reported
+    EXPECT_EQ(match_lengths, (std::vector<size_t>{0, 0, 0, 3, 0, 4}));
+}
+
+TEST(TestIncrementalStopStringMatcher, MatchesStopStringAcrossTokens) {
+    FakeDetokenizer detokenizer;
+    StopStringMatcher matcher({"world STOP"});
+    std::vector<int64_t> tokens;
+    for (int64_t token : {0, 1, 3, 5, 0, 1}) {
+        tokens.push_back(token);
+        EXPECT_FALSE(matcher.match(0, tokens, false, detokenizer).is_matched);
+    }
+    tokens.push_back(2);
+    tokens.push_back(4);
+    auto result = matcher.match(0, tokens, false, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    // "Hello world!\nHello" is kept
+    EXPECT_EQ(result.to_remove, 3);
+}
+
+TEST(TestIncrementalStopStringMatcher, IncludesStopStringToOutput) {
+    FakeDetokenizer detokenizer;
+    StopStringMatcher matcher({"STOP"});
+    std::vector<int64_t> tokens = {0, 1, 6, 7, 3, 4};
+    auto result = matcher.match(0, tokens, true, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 2);
+
+    result = matcher.match(1, tokens, false, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 4);
+}
+
+TEST(TestIncrementalStopStringMatcher, RollsBackRemovedTokens) {
+    FakeDetokenizer detokenizer;
+    StopStringMatcher matcher({"Hello world"});
+    std::vector<int64_t> tokens = {0, 3, 0};
+    EXPECT_FALSE(matcher.match(0, tokens, false, detokenizer).is_matched);
+
+    // the last token is rejected and replaced, the stop string must not be matched against the text of the rejected one
+    tokens = {0, 3, 4, 1};
+    EXPECT_FALSE(matcher.match(0, tokens, false, detokenizer).is_matched);
+
+    tokens = {0, 3, 0, 1, 3};
+    auto result = matcher.match(0, tokens, true, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 1);
+}
+
+TEST(TestIncrementalStopStringMatcher, DecodesBoundedWindow) {
+    FakeDetokenizer detokenizer;
+    StopStringMatcher matcher({"STOP"});
+    std::vector<int64_t> tokens;
+    for (size_t i = 0; i < 100; ++i) {
+        tokens.push_back(i % 2 == 0 ? 0 : 1);
+        EXPECT_FALSE(matcher.match(0, tokens, false, detokenizer).is_matched);
+    }
+    EXPECT_LE(detokenizer.max_decoded_tokens, 17);
+    // one decoding per step, including the steps after which the window is shrunk
+    EXPECT_EQ(detokenizer.num_calls, tokens.size());
+
+    tokens.push_back(2);
+    auto result = matcher.match(0, tokens, false, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 1);
+}
+
+TEST(TestIncrementalStopStringMatcher, DecodesNewTokensOfStepAtOnce) {
+    FakeDetokenizer detokenizer;
+    StopStringMatcher matcher({"again STOP"});
+    std::vector<int64_t> tokens;
+    for (size_t step = 0; step < 10; ++step) {
+        tokens.insert(tokens.end(), {0, 1, 3, 5});
+        EXPECT_FALSE(matcher.match(0, tokens, false, detokenizer).is_matched);
+    }
+    EXPECT_EQ(detokenizer.num_calls, 10);
+
+    // the last 3 tokens of the step are rejected, the first one is fed again with the new ones
+    tokens.resize(tokens.size() - 3);
+    tokens.insert(tokens.end(), {4, 2, 3, 0});
+    auto result = matcher.match(0, tokens, false, detokenizer);
+    EXPECT_TRUE(result.is_matched);
+    // "...Hello" is kept, " again STOP!Hello" is removed
+    EXPECT_EQ(result.to_remove, 4);
+}
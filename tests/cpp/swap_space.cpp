@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "continuous_batching/swap_space.hpp"
+
+namespace {
+
+ov::genai::HostKVCacheBlock create_block() {
+    ov::genai::HostKVCacheBlock block;
+    block.key_blocks.emplace_back(ov::element::f32, ov::Shape{1, 2, 4, 8});
+    block.value_blocks.emplace_back(ov::element::f32, ov::Shape{1, 2, 4, 8});
+    return block;
+}
+
+}  // namespace
+
+TEST(TestKVCacheSwapSpace, ReusesReleasedBlocks) {
+    size_t num_created_blocks = 0;
+    ov::genai::KVCacheSwapSpace swap_space(4, [&num_created_blocks] {
+        ++num_created_blocks;
+        return create_block();
+    });
+
+    EXPECT_TRUE(swap_space.can_swap_out(4));
+    EXPECT_FALSE(swap_space.can_swap_out(5));
+    auto& blocks = swap_space.swap_out(0, 3);
+    EXPECT_EQ(blocks.size(), 3);
+    blocks[2].key_blocks[0].data<float>()[0] = 42.f;
+    EXPECT_TRUE(swap_space.is_swapped_out(0));
+    EXPECT_FALSE(swap_space.can_swap_out(2));
+    EXPECT_EQ(swap_space.get_swapped_blocks(0)[2].key_blocks[0].data<float>()[0], 42.f);
+
+    swap_space.release(0);
+    EXPECT_FALSE(swap_space.is_swapped_out(0));
+    EXPECT_EQ(swap_space.num_used_blocks(), 0);
+
+    swap_space.swap_out(1, 4);
+    EXPECT_EQ(num_created_blocks, 4);
+    EXPECT_EQ(swap_space.get_swapped_out_sequence_ids(), std::vector<uint64_t>({1}));
+    EXPECT_THROW(swap_space.swap_out(2, 1), ov::Exception);
+}
+
+TEST(TestPreemptionCostModel, ComparesCopyAndRecomputeCosts) {
+    ov::genai::PreemptionCostModel cost_model;
+    // nothing is measured yet
+    EXPECT_TRUE(cost_model.is_swap_cheaper(1, 100));
+
+    // 10 ms of fixed cost and 0.1 ms per token
+    cost_model.register_inference(10, std::chrono::microseconds(11000));
+    cost_model.register_inference(100, std::chrono::microseconds(20000));
+    cost_model.register_inference(100, std::chrono::microseconds(20000));
+    EXPECT_NEAR(cost_model.get_seconds_per_token(), 1e-4, 1e-6);
+
+    cost_model.register_block_copies(10, std::chrono::microseconds(1000));
+    EXPECT_NEAR(cost_model.get_seconds_per_block_copy(), 1e-4, 1e-9);
+
+    // copying 10 blocks out and back takes 2 ms
+    EXPECT_TRUE(cost_model.is_swap_cheaper(100, 10));
+    EXPECT_FALSE(cost_model.is_swap_cheaper(10, 10));
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "sampling/threadpool.hpp"
+
+TEST(TestThreadPool, ParallelForProcessesEachItemOnce) {
+    ThreadPool thread_pool(4);
+    for (size_t num_items : {0, 1, 3, 5, 128, 1000}) {
+        std::vector<std::atomic<size_t>> num_calls(num_items);
+        std::atomic<bool> is_worker_idx_valid{true};
+        thread_pool.parallel_for(num_items, [&](size_t item_idx, size_t worker_idx) {
+            if (worker_idx > thread_pool.size()) {
+                is_worker_idx_valid = false;
+            }
+            ++num_calls[item_idx];
+        });
+        EXPECT_TRUE(is_worker_idx_valid.load());
+        for (size_t item_idx = 0; item_idx < num_items; ++item_idx) {
+            EXPECT_EQ(num_calls[item_idx].load(), 1);
+        }
+    }
+}
+
+TEST(TestThreadPool, ParallelForRethrowsExceptions) {
+    ThreadPool thread_pool(4);
+    EXPECT_THROW(thread_pool.parallel_for(64, [](size_t item_idx, size_t) {
+        if (item_idx == 42) {
+            throw std::runtime_error("item failed");
+        }
+    }), std::runtime_error);
+
+    // the pool stays usable
+    std::atomic<size_t> num_calls{0};
+    thread_pool.parallel_for(64, [&num_calls](size_t, size_t) { ++num_calls; });
+    EXPECT_EQ(num_calls.load(), 64);
+}
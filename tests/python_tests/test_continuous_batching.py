@@ -9,7 +9,8 @@ import sys
 from pathlib import Path
 from shutil import rmtree
 
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason, ChatHistory
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason, ChatHistory, \
+    Adapter, AdapterConfig, Tokenizer
 
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
 
@@ -735,3 +736,100 @@ def test_dynamic_split_fuse_for_speculative_decoding():
 
 def test_dynamic_split_fuse_for_eagle3():
     compare_results_for_dynamic_split_fuse_config("Qwen/Qwen3-1.7B", "AngelSlim/Qwen3-1.7B_eagle3")
+
+
+#
+# LoRA adapters applied per request
+#
+
+def save_random_lora_adapter(path: Path, seed: int, num_layers: int = 12, hidden_size: int = 768, rank: int = 8) -> Path:
+    import torch
+    from safetensors.torch import save_file
+
+    generator = torch.Generator().manual_seed(seed)
+    tensors = {}
+    for layer in range(num_layers):
+        for projection in ["q_proj", "v_proj"]:
+            name = f"base_model.model.model.decoder.layers.{layer}.self_attn.{projection}"
+            tensors[f"{name}.lora_A.weight"] = torch.randn(rank, hidden_size, generator=generator) * 0.05
+            tensors[f"{name}.lora_B.weight"] = torch.randn(hidden_size, rank, generator=generator) * 0.05
+    save_file(tensors, path)
+    return path
+
+
+def test_per_request_adapters_match_single_adapter_runs(model_facebook_opt_125m: OVConvertedModelSchema, tmp_path: Path):
+    models_path = model_facebook_opt_125m.models_path
+    adapters = [Adapter(save_random_lora_adapter(tmp_path / f"adapter_{seed}.safetensors", seed)) for seed in [1, 2]]
+
+    # the same prompt with different adapters checks that prefix cached blocks are not shared between adapters
+    prompts = ["What is OpenVINO?", "What is OpenVINO?", "Why is the Sun yellow?", "What is OpenVINO?"]
+    request_adapters = [
+        AdapterConfig(adapters[0]),
+        AdapterConfig(adapters[1]),
+        AdapterConfig([(adapters[0], 0.5), (adapters[1], 1.0)]),
+        AdapterConfig(),
+    ]
+
+    scheduler_config = dict_to_scheduler_config()
+    scheduler_config.enable_prefix_caching = True
+
+    generation_configs = []
+    for adapter_config in request_adapters:
+        generation_config = get_greedy()
+        generation_config.adapters = adapter_config
+        generation_configs.append(generation_config)
+
+    # in the reference pipeline all requests of a generate call use the same adapters, so the prompts are run one by one
+    ref_scheduler_config = dict_to_scheduler_config()
+    ref_scheduler_config.enable_prefix_caching = False
+    ref_pipe = ContinuousBatchingPipeline(models_path, Tokenizer(models_path), ref_scheduler_config, "CPU",
+                                          adapters=AdapterConfig(adapters, AdapterConfig.Mode.MODE_DYNAMIC))
+    reference = [ref_pipe.generate([prompt], [generation_config])[0] for prompt, generation_config in zip(prompts, generation_configs)]
+    del ref_pipe
+
+    pipe = ContinuousBatchingPipeline(models_path, Tokenizer(models_path), scheduler_config, "CPU",
+                                      adapters=AdapterConfig(adapters, AdapterConfig.Mode.MODE_PER_REQUEST))
+    results = pipe.generate(prompts, generation_configs)
+
+    for result, ref in zip(results, reference):
+        assert result.m_generation_ids == ref.m_generation_ids
+
+    # adapters unknown to the pipeline are rejected
+    unknown_adapter_config = get_greedy()
+    unknown_adapter_config.adapters = AdapterConfig(Adapter(save_random_lora_adapter(tmp_path / "adapter_3.safetensors", 3)))
+    with pytest.raises(RuntimeError):
+        pipe.generate(prompts[:1], [unknown_adapter_config])
+
+
+def test_switching_adapters_matches_fresh_apply(model_facebook_opt_125m: OVConvertedModelSchema, tmp_path: Path):
+    # switching back to a previous adapter reuses cached LoRA states and changing only alphas updates only the alpha
+    # states, so each switch is compared with a pipeline which applies the same config from scratch
+    models_path = model_facebook_opt_125m.models_path
+    adapters = [Adapter(save_random_lora_adapter(tmp_path / f"adapter_{seed}.safetensors", seed)) for seed in [1, 2]]
+    adapter_configs = [
+        AdapterConfig(adapters[0]),
+        AdapterConfig(adapters[1]),
+        AdapterConfig(adapters[0]),
+        AdapterConfig(adapters[0], 0.5),
+        AdapterConfig([(adapters[0], 0.5), (adapters[1], 1.0)]),
+        AdapterConfig([(adapters[0], 0.5), (adapters[1], 0.25)]),
+        AdapterConfig(adapters[0]),
+    ]
+    prompt = "What is OpenVINO?"
+
+    def get_generation_config(adapter_config: AdapterConfig):
+        generation_config = get_greedy()
+        generation_config.adapters = adapter_config
+        return generation_config
+
+    pipe = ContinuousBatchingPipeline(models_path, Tokenizer(models_path), dict_to_scheduler_config(), "CPU",
+                                      adapters=AdapterConfig(adapters, AdapterConfig.Mode.MODE_DYNAMIC))
+    results = [pipe.generate([prompt], [get_generation_config(adapter_config)])[0] for adapter_config in adapter_configs]
+    del pipe
+
+    for adapter_config, result in zip(adapter_configs, results):
+        ref_pipe = ContinuousBatchingPipeline(models_path, Tokenizer(models_path), dict_to_scheduler_config(), "CPU",
+                                              adapters=AdapterConfig(adapters, AdapterConfig.Mode.MODE_DYNAMIC))
+        ref = ref_pipe.generate([prompt], [get_generation_config(adapter_config)])[0]
+        del ref_pipe
+        assert result.m_generation_ids == ref.m_generation_ids
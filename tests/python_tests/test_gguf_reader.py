@@ -5,6 +5,8 @@
 import pytest
 import torch
 import gc
+import os
+import shutil
 import sys
 from pathlib import Path
 from dataclasses import dataclass
@@ -24,6 +26,7 @@ from utils.ov_genai_pipelines import (
     GGUF_PIPELINE_TYPES,
     PipelineType,
 )
+from utils.constants import get_default_llm_properties
 from data.models import GGUF_MODEL_LIST
 
 
@@ -222,3 +225,51 @@ def test_full_gguf_qwen3_pipeline(pipeline_type, model_ids):
     res_string_input_2 = ov_pipe_gguf.generate(prompt, generation_config=ov_generation_config)
 
     assert res_string_input_1 == res_string_input_2
+
+
+@pytest.mark.skipif(sys.platform == "win32", reason="CVS-174065")
+def test_gguf_model_cache(tmp_path):
+    if sys.platform == 'darwin':
+        pytest.skip(reason="168882: Sporadic segmentation fault failure on MacOS.")
+
+    gguf_model_id = GGUF_MODEL_LIST[0]["gguf_model_id"]
+    gguf_filename = GGUF_MODEL_LIST[0]["gguf_filename"]
+    model_dir = tmp_path / "model"
+    model_dir.mkdir()
+    gguf_path = model_dir / gguf_filename
+    # the copy is modified by the test, the downloaded file is shared with other tests
+    shutil.copyfile(download_gguf_model(gguf_model_id, gguf_filename), gguf_path)
+    cache_dir = tmp_path / "cache"
+
+    prompt = 'Why is the Sun yellow?'
+    generation_config = ov_genai.GenerationConfig(max_new_tokens=30, apply_chat_template=False)
+
+    def generate(**properties) -> str:
+        ov_pipe = ov_genai.LLMPipeline(gguf_path, "CPU", {**get_default_llm_properties(), **properties})
+        result = ov_pipe.generate(prompt, generation_config=generation_config)
+        del ov_pipe
+        gc.collect()
+        return result
+
+    def cached_models() -> dict[str, float]:
+        return {path.parent.name: path.stat().st_mtime_ns for path in (cache_dir / "gguf").glob("*/openvino_model.xml")}
+
+    reference = generate()
+
+    assert generate(CACHE_DIR=str(cache_dir)) == reference
+    models = cached_models()
+    assert len(models) == 1
+
+    # the same file is read from the cache
+    assert generate(CACHE_DIR=str(cache_dir)) == reference
+    assert cached_models() == models
+
+    # other properties do not use the model built with the previous ones
+    generate(CACHE_DIR=str(cache_dir), DYNAMIC_QUANTIZATION_GROUP_SIZE="64")
+    assert len(cached_models()) == 2
+
+    # a changed file is built again
+    stat = gguf_path.stat()
+    os.utime(gguf_path, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1_000_000_000))
+    assert generate(CACHE_DIR=str(cache_dir)) == reference
+    assert len(cached_models()) == 3
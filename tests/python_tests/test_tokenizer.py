@@ -502,6 +502,63 @@ def test_padding(
     assert np.all(ov_res.attention_mask.data == hf_res["attention_mask"])
 
 
+bucketed_prompts = [
+    "Why is the Sun yellow?",
+    "1+1=",
+    "若我有一亿美元，在人工智能盛行的今天，我怎样投资才能收益最大化？",
+    "what",
+    "Multiline\nstring!\nWow!",
+    "What is the previous answer? " * 10,
+    "מחרוזת בדיקה",
+]
+
+
+@pytest.mark.parametrize("bucket_size", [None, 1, 2, 3, 100])
+@pytest.mark.parametrize("padding_side", [None, "right", "left"])
+@pytest.mark.parametrize("max_length", [None, 8])
+@pytest.mark.parametrize(
+    "hf_ov_genai_models",
+    [
+        ("TinyLlama/TinyLlama-1.1B-Chat-v1.0", {"padding_side": None}),
+        ("optimum-intel-internal-testing/tiny-random-llava-next", {"padding_side": "left"}),
+    ],
+    ids=[
+        "TinyLlama-1.1B-Chat-v1.0",
+        "llava-next-left",
+    ],
+    indirect=True,
+)
+def test_encode_in_buckets(hf_ov_genai_models, bucket_size, padding_side, max_length):
+    # prompts are not ordered by length, so buckets are reassembled in a different order than they are tokenized
+    _, genai_tokenizer = hf_ov_genai_models
+    ov_params = {}
+    if padding_side is not None:
+        ov_params["padding_side"] = padding_side
+    if max_length is not None:
+        ov_params["max_length"] = max_length
+
+    ref = genai_tokenizer.encode(bucketed_prompts, **ov_params)
+    ref_ids = ref.input_ids.data
+    ref_mask = ref.attention_mask.data
+    assert ref.offsets is None
+
+    if bucket_size is not None:
+        res = genai_tokenizer.encode(bucketed_prompts, bucket_size=bucket_size, **ov_params)
+        assert res.offsets is None
+        assert np.array_equal(res.input_ids.data, ref_ids)
+        assert np.array_equal(res.attention_mask.data, ref_mask)
+
+    ragged = genai_tokenizer.encode(bucketed_prompts, bucket_size=bucket_size, return_ragged=True, **ov_params)
+    offsets = ragged.offsets.data
+    assert ragged.input_ids.data.ndim == 1
+    assert offsets.shape == (len(bucketed_prompts) + 1,)
+    assert offsets[0] == 0 and offsets[-1] == ragged.input_ids.data.shape[0]
+    assert np.all(ragged.attention_mask.data == 1)
+    for i in range(len(bucketed_prompts)):
+        expected = ref_ids[i][ref_mask[i] == 1]
+        assert np.array_equal(ragged.input_ids.data[offsets[i] : offsets[i + 1]], expected)
+
+
 # Define model base configs
 base_models_for_paired_input_test = [
     ("answerdotai/ModernBERT-base", {"padding_side": None}),